@@ -0,0 +1,82 @@
+#include "eth.hpp"
+
+#include <jsonrpccpp/common/exception.h>
+#include <libdevcore/CommonJS.h>
+
+namespace taraxa::aleth {
+using namespace dev;
+using namespace std;
+
+Json::Value Eth::eth_getLogs(Json::Value const& _json) {
+  // Filter by block hash is single block, there is nothing to index
+  if (_json.isMember("blockHash")) {
+    return dev::rpc::Eth::eth_getLogs(_json);
+  }
+  auto const last_blk_n = final_chain_->last_block_number();
+  auto parse_blk_n = [&](char const* field) -> BlockNumber {
+    auto const& value = _json[field];
+    if (value.isNull()) {
+      return last_blk_n;
+    }
+    auto const& str = value.asString();
+    if (str == "latest" || str == "pending") {
+      return last_blk_n;
+    }
+    if (str == "earliest") {
+      return 0;
+    }
+    return jsToInt(str);
+  };
+  auto parse_values = [](Json::Value const& json, auto& values) {
+    using Value = typename std::decay_t<decltype(values)>::value_type;
+    if (json.isString()) {
+      values.emplace_back(Value(json.asString()));
+    } else if (json.isArray()) {
+      for (auto const& value : json) {
+        values.emplace_back(Value(value.asString()));
+      }
+    }
+  };
+
+  final_chain::LogQuery q;
+  q.from_block = parse_blk_n("fromBlock");
+  q.to_block = std::min(parse_blk_n("toBlock"), last_blk_n);
+  parse_values(_json["address"], q.addresses);
+  for (auto const& topics : _json["topics"]) {
+    parse_values(topics, q.topics.emplace_back());
+  }
+  if (logs_limits_.max_block_range && q.from_block <= q.to_block &&
+      q.to_block - q.from_block >= logs_limits_.max_block_range) {
+    BOOST_THROW_EXCEPTION(jsonrpc::JsonRpcException(
+        jsonrpc::Errors::ERROR_RPC_INVALID_PARAMS,
+        "Block range is too large, max is " + std::to_string(logs_limits_.max_block_range) + " blocks"));
+  }
+  q.max_results = logs_limits_.max_results;
+
+  auto const logs = final_chain_->query_logs(q);
+  if (logs_limits_.max_results && logs.size() > logs_limits_.max_results) {
+    BOOST_THROW_EXCEPTION(jsonrpc::JsonRpcException(
+        jsonrpc::Errors::ERROR_RPC_INVALID_PARAMS,
+        "Query returns more than " + std::to_string(logs_limits_.max_results) + " logs, narrow the block range"));
+  }
+  Json::Value res(Json::arrayValue);
+  for (auto const& log : logs) {
+    Json::Value log_json(Json::objectValue);
+    log_json["address"] = toJS(log.entry.address);
+    log_json["data"] = toJS(log.entry.data);
+    log_json["topics"] = Json::Value(Json::arrayValue);
+    for (auto const& topic : log.entry.topics) {
+      log_json["topics"].append(toJS(topic));
+    }
+    log_json["blockNumber"] = toJS(log.blk_n);
+    log_json["blockHash"] = toJS(log.blk_hash);
+    log_json["transactionHash"] = toJS(log.trx_hash);
+    log_json["transactionIndex"] = toJS(log.trx_idx);
+    log_json["logIndex"] = toJS(log.log_idx);
+    log_json["removed"] = false;
+    res.append(log_json);
+  }
+  return res;
+}
+
+}  // namespace taraxa::aleth
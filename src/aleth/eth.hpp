@@ -0,0 +1,33 @@
+#pragma once
+
+#include <libweb3jsonrpc/Eth.h>
+
+#include "chain/final_chain.hpp"
+
+namespace taraxa::aleth {
+
+/**
+ * Eth json-rpc api with eth_getLogs served from the log index of final chain instead of scanning blocks
+ */
+class Eth : public dev::rpc::Eth {
+ public:
+  // Limits of a single eth_getLogs call, 0 means no limit
+  struct LogsLimits {
+    uint64_t max_block_range = 0;
+    size_t max_results = 0;
+  };
+
+  template <typename... EthArgs>
+  explicit Eth(std::shared_ptr<FinalChain> final_chain, LogsLimits const& logs_limits, EthArgs&&... eth_args)
+      : dev::rpc::Eth(std::forward<EthArgs>(eth_args)...),
+        final_chain_(std::move(final_chain)),
+        logs_limits_(logs_limits) {}
+
+  Json::Value eth_getLogs(Json::Value const& _json) override;
+
+ private:
+  std::shared_ptr<FinalChain> final_chain_;
+  LogsLimits const logs_limits_;
+};
+
+}  // namespace taraxa::aleth
@@ -8,9 +8,10 @@ using namespace std;
 
 struct StateAPIImpl : virtual Eth::StateAPI {
   shared_ptr<FinalChain> final_chain;
+  unique_ptr<StateCallPool> call_pool;
 
   auto call_internal(BlockNumber _blockNumber, TransactionSkeleton const& trx, bool free_gas) const {
-    return final_chain->call(
+    return call_pool->call(
         {
             trx.from,
             trx.gasPrice.value_or(0),
@@ -61,8 +62,9 @@ struct StateAPIImpl : virtual Eth::StateAPI {
   }
 };
 
-unique_ptr<Eth::StateAPI> NewStateAPI(shared_ptr<FinalChain> final_chain) {
+unique_ptr<Eth::StateAPI> NewStateAPI(shared_ptr<FinalChain> final_chain, StateCallPool::Opts const& call_opts) {
   auto ret = u_ptr(new StateAPIImpl);
+  ret->call_pool = make_unique<StateCallPool>(final_chain, call_opts);
   ret->final_chain = move(final_chain);
   return ret;
 }
@@ -3,9 +3,11 @@
 #include <libweb3jsonrpc/Eth.h>
 
 #include "chain/final_chain.hpp"
+#include "chain/state_call_pool.hpp"
 
 namespace taraxa::aleth {
 
-std::unique_ptr<dev::rpc::Eth::StateAPI> NewStateAPI(std::shared_ptr<FinalChain> final_chain);
+std::unique_ptr<dev::rpc::Eth::StateAPI> NewStateAPI(std::shared_ptr<FinalChain> final_chain,
+                                                     StateCallPool::Opts const& call_opts = {});
 
 }  // namespace taraxa::aleth
@@ -13,11 +13,23 @@ auto map_transactions(Transactions const& trxs) {
   });
 }
 
+// Key of state cache entry: query kind followed by query parameters
+string state_cache_key(char kind, initializer_list<bytesConstRef> params) {
+  string ret(1, kind);
+  for (auto const& param : params) {
+    ret.append(reinterpret_cast<char const*>(param.data()), param.size());
+  }
+  return ret;
+}
+
 struct FinalChainImpl : virtual FinalChain, virtual ChainDBImpl {
   shared_ptr<aleth::Database> blk_db;
   shared_ptr<aleth::Database> ext_db;
   StateAPI state_api;
   TransactionReceipts receipts_buf;
+  LogIndex log_index;
+  mutable StateCache state_cache;
+  fs::path const state_checkpoint_path;
 
   FinalChainImpl(shared_ptr<DbStorage> db,
                  Config const& config,     //
@@ -34,8 +46,14 @@ struct FinalChainImpl : virtual FinalChain, virtual ChainDBImpl {
                       4,
                   },
                   {
-                      (db->stateDbStoragePath()).string(),
-                  }) {
+                      prepare_state_db(db->stateDbStoragePath(), db->stateDbCheckpointPath(), config.state),
+                  }),
+        log_index(db, [this] {
+          auto last_blk = ChainDBImpl::get_last_block();
+          return last_blk ? last_blk->number() : 0;
+        }()),
+        state_cache(opts.state_cache),
+        state_checkpoint_path(db->stateDbCheckpointPath()) {
     receipts_buf.reserve(opts.state_api.ExpectedMaxTrxPerBlock);
     auto last_blk = ChainDBImpl::get_last_block();
     auto state_desc = state_api.get_last_committed_state_descriptor();
@@ -50,25 +68,82 @@ struct FinalChainImpl : virtual FinalChain, virtual ChainDBImpl {
       return;
     }
     auto blk_n = last_blk->number();
-    if (blk_n == state_desc.blk_num) {
-      return;
+    // State db ahead of the last block was replaced by its checkpoint in prepare_state_db
+    assert(state_desc.blk_num <= blk_n);
+    // Blocks might be committed without sync (see ExecutorConfig), state db then is behind by more than one block
+    for (auto n = state_desc.blk_num + 1; n <= blk_n; ++n) {
+      auto const& header = n == blk_n ? *last_blk : blockHeader(n);
+      auto res = state_api.transition_state(
+          {
+              header.author(),
+              header.gasLimit(),
+              header.timestamp(),
+              header.difficulty(),
+          },
+          map_transactions(ChainDBImpl::transactions(n)),  //
+          {});
+      assert(res.StateRoot == header.stateRoot());
+      state_api.transition_state_commit();
+    }
+  }
+
+  BlockNumber state_db_blk_num(fs::path const& path, state_api::ChainConfig const& config) {
+    StateAPI state([this](auto n) { return ChainDBImpl::hashFromNumber(n); }, config, {1500, 4}, {path.string()});
+    return state.get_last_committed_state_descriptor().blk_num;
+  }
+
+  // Path of the complete state db checkpoint, the previous one is kept while the new one is moved in place
+  static optional<fs::path> find_state_checkpoint(fs::path const& checkpoint_path) {
+    for (auto const& path : {checkpoint_path, fs::path(checkpoint_path.string() + ".old")}) {
+      if (fs::exists(path)) {
+        return path;
+      }
     }
-    if (state_desc.blk_num != blk_n - 1) {
-      cerr << "state db last executed block number (" << state_desc.blk_num << ") is expected to be " << blk_n - 1
-           << endl;
-      exit(1);
+    return nullopt;
+  }
+
+  // Blocks might be committed to main db without sync (see ExecutorConfig) while their state is already persisted by
+  // state db, after OS crash state db can be ahead of the last block. State db commits cannot be reverted, so such
+  // state db is replaced by its checkpoint taken at a synced period, blocks after it are executed again by constructor
+  string prepare_state_db(fs::path const& path, fs::path const& checkpoint_path,
+                          state_api::ChainConfig const& config) {
+    auto last_blk = ChainDBImpl::get_last_block();
+    if (!last_blk) {
+      return path.string();
     }
-    auto res = state_api.transition_state(
-        {
-            last_blk->author(),
-            last_blk->gasLimit(),
-            last_blk->timestamp(),
-            last_blk->difficulty(),
-        },
-        map_transactions(ChainDBImpl::transactions(blk_n)),  //
-        {});
-    assert(res.StateRoot == last_blk->stateRoot());
-    state_api.transition_state_commit();
+    auto checkpoint = find_state_checkpoint(checkpoint_path);
+    if (fs::exists(path)) {
+      auto state_blk_n = state_db_blk_num(path, config);
+      if (state_blk_n <= last_blk->number()) {
+        return path.string();
+      }
+      if (!checkpoint || state_db_blk_num(*checkpoint, config) > last_blk->number()) {
+        throw std::runtime_error("state db last executed block number (" + to_string(state_blk_n) +
+                                 ") is ahead of the last block (" + to_string(last_blk->number()) +
+                                 ") and there is no state db checkpoint behind it");
+      }
+      cerr << "state db last executed block number (" << state_blk_n << ") is ahead of the last block ("
+           << last_blk->number() << "), state db is restored from checkpoint" << endl;
+      fs::remove_all(path);
+    } else if (!checkpoint) {
+      return path.string();
+    }
+    // Also completes restore interrupted between removal of state db and the rename
+    fs::rename(*checkpoint, path);
+    return path.string();
+  }
+
+  void checkpoint_state() override {
+    auto tmp_path = state_checkpoint_path.string() + ".tmp", old_path = state_checkpoint_path.string() + ".old";
+    fs::remove_all(tmp_path);
+    state_api.create_checkpoint(tmp_path);
+    // Complete checkpoint exists at every step, see find_state_checkpoint
+    if (fs::exists(state_checkpoint_path)) {
+      fs::remove_all(old_path);
+      fs::rename(state_checkpoint_path, old_path);
+    }
+    fs::rename(tmp_path, state_checkpoint_path);
+    fs::remove_all(old_path);
   }
 
   std::pair<val_t, bool> getBalance(addr_t const& addr) const override {
@@ -118,8 +193,12 @@ struct FinalChainImpl : virtual FinalChain, virtual ChainDBImpl {
                                 move(logs), r.NewContractAddr);
     }
     auto exit_stack = append_block_prepare(batch);
+    auto new_header =
+        append_block(author, timestamp, gas_limit, state_transition_result.StateRoot, transactions, receipts_buf);
+    log_index.append(batch, new_header.number(), new_header.hash(), transactions,
+                     state_transition_result.ExecutionResults);
     return {
-        append_block(author, timestamp, gas_limit, state_transition_result.StateRoot, transactions, receipts_buf),
+        move(new_header),
         receipts_buf,
         state_transition_result,
     };
@@ -128,20 +207,71 @@ struct FinalChainImpl : virtual FinalChain, virtual ChainDBImpl {
   void advance_confirm() override {
     state_api.transition_state_commit();
     refresh_last_block();
+    log_index.confirm();
+    state_cache.onNewBlock(last_block_number());
   }
 
   void create_snapshot(uint64_t const& period) override { state_api.create_snapshot(period); }
 
   optional<state_api::Account> get_account(addr_t const& addr, optional<BlockNumber> blk_n = nullopt) const override {
-    return state_api.get_account(normalize_client_blk_n(blk_n), addr);
+    auto const n = normalize_client_blk_n(blk_n);
+    return state_cache.get<optional<state_api::Account>>(n, state_cache_key('a', {addr.ref()}),
+                                                         [&] { return state_api.get_account(n, addr); });
   }
 
   u256 get_account_storage(addr_t const& addr, u256 const& key, optional<BlockNumber> blk_n = nullopt) const override {
-    return state_api.get_account_storage(normalize_client_blk_n(blk_n), addr, key);
+    auto const n = normalize_client_blk_n(blk_n);
+    return state_cache.get<u256>(n, state_cache_key('s', {addr.ref(), h256(key).ref()}),
+                                 [&] { return state_api.get_account_storage(n, addr, key); });
   }
 
   bytes get_code(addr_t const& addr, optional<BlockNumber> blk_n = nullopt) const override {
-    return state_api.get_code_by_address(normalize_client_blk_n(blk_n), addr);
+    auto const n = normalize_client_blk_n(blk_n);
+    return state_cache.get<bytes>(n, state_cache_key('c', {addr.ref()}),
+                                  [&] { return state_api.get_code_by_address(n, addr); });
+  }
+
+  vector<optional<state_api::Account>> get_accounts(vector<addr_t> const& addrs,
+                                                    optional<BlockNumber> blk_n = nullopt) const override {
+    auto const n = normalize_client_blk_n(blk_n);
+    return get_cached_batch<optional<state_api::Account>>(
+        n, addrs, [](auto const& addr) { return state_cache_key('a', {addr.ref()}); },
+        [&](auto const& missed, auto& result) { state_api.get_accounts(n, missed, result); });
+  }
+
+  vector<u256> get_account_storage(addr_t const& addr, vector<u256> const& keys,
+                                   optional<BlockNumber> blk_n = nullopt) const override {
+    auto const n = normalize_client_blk_n(blk_n);
+    return get_cached_batch<u256>(
+        n, keys, [&](auto const& key) { return state_cache_key('s', {addr.ref(), h256(key).ref()}); },
+        [&](auto const& missed, auto& result) { state_api.get_account_storage(n, addr, missed, result); });
+  }
+
+  // Reads cached items, the rest are loaded by one multi-item state api query
+  template <typename T, typename Item, typename Key, typename LoadBatch>
+  vector<T> get_cached_batch(BlockNumber n, vector<Item> const& items, Key const& key,
+                             LoadBatch const& load_batch) const {
+    vector<T> ret(items.size());
+    vector<size_t> missed_idx;
+    vector<Item> missed;
+    for (size_t i = 0; i < items.size(); ++i) {
+      if (auto cached = state_cache.lookup<T>(n, key(items[i]))) {
+        ret[i] = move(*cached);
+      } else {
+        missed_idx.push_back(i);
+        missed.push_back(items[i]);
+      }
+    }
+    if (missed.empty()) {
+      return ret;
+    }
+    vector<T> loaded;
+    load_batch(missed, loaded);
+    for (size_t i = 0; i < missed.size(); ++i) {
+      state_cache.put(n, key(missed[i]), loaded[i]);
+      ret[missed_idx[i]] = move(loaded[i]);
+    }
+    return ret;
   }
 
   state_api::ExecutionResult call(state_api::EVMTransaction const& trx, optional<BlockNumber> blk_n = nullopt,
@@ -173,8 +303,16 @@ struct FinalChainImpl : virtual FinalChain, virtual ChainDBImpl {
 
   state_api::DPOSQueryResult dpos_query(state_api::DPOSQuery const& q,
                                         optional<BlockNumber> blk_n = nullopt) const override {
-    return state_api.dpos_query(normalize_client_blk_n(blk_n), q);
+    auto const n = normalize_client_blk_n(blk_n);
+    RLPStream q_rlp;
+    enc_rlp(q_rlp, q);
+    return state_cache.get<state_api::DPOSQueryResult>(n, state_cache_key('d', {&q_rlp.out()}),
+                                                       [&] { return state_api.dpos_query(n, q); });
   }
+
+  vector<LocalisedLog> query_logs(LogQuery const& q) const override { return log_index.query(q); }
+
+  StateCache::Stats state_cache_stats() const override { return state_cache.stats(); }
 };
 
 unique_ptr<FinalChain> NewFinalChain(shared_ptr<DbStorage> db, FinalChain::Config const& config,
@@ -4,7 +4,9 @@
 
 #include "aleth/database.hpp"
 #include "common/types.hpp"
+#include "log_index.hpp"
 #include "state_api.hpp"
+#include "state_cache.hpp"
 #include "storage/db_storage.hpp"
 #include "util/exit_stack.hpp"
 #include "util/range_view.hpp"
@@ -26,6 +28,7 @@ struct FinalChain : virtual ChainDB {
 
   struct Opts {
     state_api::Opts state_api;
+    StateCache::Opts state_cache;
   };
 
   virtual ~FinalChain() {}
@@ -40,10 +43,17 @@ struct FinalChain : virtual ChainDB {
   virtual shared_ptr<BlockHeader> get_last_block() const = 0;
   virtual void advance_confirm() = 0;
   virtual void create_snapshot(uint64_t const& period) = 0;
+  // Replaces checkpoint of the state db that is restored on startup when the state db is ahead of the last block.
+  // Must only be called when main db writes up to the last block are synced
+  virtual void checkpoint_state() = 0;
   virtual optional<state_api::Account> get_account(addr_t const& addr, optional<BlockNumber> blk_n = nullopt) const = 0;
   virtual u256 get_account_storage(addr_t const& addr, u256 const& key,
                                    optional<BlockNumber> blk_n = nullopt) const = 0;
   virtual bytes get_code(addr_t const& addr, optional<BlockNumber> blk_n = nullopt) const = 0;
+  virtual vector<optional<state_api::Account>> get_accounts(vector<addr_t> const& addrs,
+                                                            optional<BlockNumber> blk_n = nullopt) const = 0;
+  virtual vector<u256> get_account_storage(addr_t const& addr, vector<u256> const& keys,
+                                           optional<BlockNumber> blk_n = nullopt) const = 0;
   virtual state_api::ExecutionResult call(state_api::EVMTransaction const& trx, optional<BlockNumber> blk_n = nullopt,
                                           optional<state_api::ExecutionOptions> const& opts = nullopt) const = 0;
   virtual std::pair<val_t, bool> getBalance(addr_t const& acc) const = 0;
@@ -54,6 +64,8 @@ struct FinalChain : virtual ChainDB {
   virtual bool dpos_is_eligible(BlockNumber blk_num, addr_t const& addr) const = 0;
   virtual state_api::DPOSQueryResult dpos_query(state_api::DPOSQuery const& q,
                                                 optional<BlockNumber> blk_n = nullopt) const = 0;
+  virtual vector<LocalisedLog> query_logs(LogQuery const& q) const = 0;
+  virtual StateCache::Stats state_cache_stats() const = 0;
 };
 
 unique_ptr<FinalChain> NewFinalChain(shared_ptr<DbStorage> db, FinalChain::Config const& config,
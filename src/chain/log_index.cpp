@@ -0,0 +1,300 @@
+#include "log_index.hpp"
+
+#include <algorithm>
+
+namespace taraxa::final_chain {
+using dev::eth::LogBloom;
+using dev::eth::LogEntry;
+
+namespace {
+
+template <unsigned N>
+LogBloom bloomOf(dev::FixedHash<N> const& value) {
+  return LogBloom().shiftBloom<3>(dev::sha3(value.ref()));
+}
+
+LogBloom bloomOf(addr_t const& address, std::vector<h256> const& topics) {
+  auto ret = bloomOf(address);
+  for (auto const& topic : topics) {
+    ret |= bloomOf(topic);
+  }
+  return ret;
+}
+
+template <typename OnLog>
+void decodeLogs(uint64_t blk_n, std::string const& raw, OnLog const& on_log) {
+  if (raw.empty()) {
+    return;
+  }
+  RLP const rlp(raw);
+  auto const blk_hash = rlp[0].toHash<h256>();
+  uint32_t log_idx = 0;
+  for (auto const& log_rlp : rlp[1]) {
+    LocalisedLog log;
+    log.entry = LogEntry(log_rlp[2].toHash<addr_t>(), log_rlp[3].toVector<h256>(), log_rlp[4].toBytes());
+    log.blk_n = blk_n;
+    log.blk_hash = blk_hash;
+    log.trx_hash = log_rlp[0].toHash<h256>();
+    log.trx_idx = log_rlp[1].toInt<uint32_t>();
+    log.log_idx = log_idx++;
+    on_log(std::move(log));
+  }
+}
+
+}  // namespace
+
+bool LogQuery::matches(LogEntry const& log) const {
+  if (!addresses.empty() && std::find(addresses.begin(), addresses.end(), log.address) == addresses.end()) {
+    return false;
+  }
+  for (size_t i = 0; i < topics.size(); ++i) {
+    if (topics[i].empty()) {
+      continue;
+    }
+    if (log.topics.size() <= i || std::find(topics[i].begin(), topics[i].end(), log.topics[i]) == topics[i].end()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+LogIndex::LogIndex(std::shared_ptr<DbStorage> db, BlockNumber last_blk_n) : db_(std::move(db)) {
+  sealed_sections_ = (last_blk_n + 1) / c_section_size;
+  // Restore blooms of the current section
+  auto const section_begin = sealed_sections_ * c_section_size;
+  if (last_blk_n < section_begin) {
+    return;
+  }
+  DbStorage::MultiGetQuery db_query(db_, last_blk_n - section_begin + 1);
+  for (uint64_t blk_n = section_begin; blk_n <= last_blk_n; ++blk_n) {
+    db_query.append(DbStorage::Columns::block_logs, blk_n);
+  }
+  auto records = db_query.execute();
+  for (size_t i = 0; i < records.size(); ++i) {
+    decodeLogs(section_begin + i, records[i], [this](LocalisedLog&& log) {
+      section_blooms_[log.blk_n] |= bloomOf(log.entry.address, log.entry.topics);
+    });
+  }
+}
+
+void LogIndex::append(DbStorage::BatchPtr const& batch, BlockNumber blk_n, h256 const& blk_hash,
+                      dev::eth::Transactions const& transactions,
+                      std::vector<state_api::ExecutionResult> const& execution_results) {
+  Pending pending{blk_n, std::nullopt};
+  size_t logs_count = 0;
+  for (auto const& result : execution_results) {
+    logs_count += result.Logs.size();
+  }
+  if (logs_count) {
+    LogBloom bloom;
+    RLPStream rlp(2);
+    rlp << blk_hash;
+    rlp.appendList(logs_count);
+    for (uint32_t trx_idx = 0; trx_idx < execution_results.size(); ++trx_idx) {
+      for (auto const& log : execution_results[trx_idx].Logs) {
+        rlp.appendList(5) << transactions[trx_idx].sha3() << trx_idx << log.Address << log.Topics << log.Data;
+        bloom |= bloomOf(log.Address, log.Topics);
+      }
+    }
+    db_->batch_put(*batch, DbStorage::Columns::block_logs, uint64_t(blk_n), rlp.out());
+    pending.bloom = bloom;
+  }
+  // Section is written in the batch of its last block
+  if ((blk_n + 1) % c_section_size == 0) {
+    auto blooms = section_blooms_;
+    if (pending.bloom) {
+      blooms[blk_n] = *pending.bloom;
+    }
+    sealSection(batch, blk_n / c_section_size, blooms);
+  }
+  pending_ = std::move(pending);
+}
+
+void LogIndex::confirm() {
+  if (!pending_) {
+    return;
+  }
+  uLock lock(mu_);
+  if (pending_->bloom) {
+    section_blooms_[pending_->blk_n] = *pending_->bloom;
+  }
+  if ((pending_->blk_n + 1) % c_section_size == 0) {
+    section_blooms_.clear();
+    sealed_sections_ = (pending_->blk_n + 1) / c_section_size;
+  }
+  pending_.reset();
+}
+
+std::vector<LocalisedLog> LogIndex::query(LogQuery const& q) const {
+  if (q.to_block < q.from_block) {
+    return {};
+  }
+  std::vector<BitsAlternatives> criteria;
+  auto add_criterion = [&](auto const& values) {
+    if (values.empty()) {
+      return;
+    }
+    auto& alternatives = criteria.emplace_back();
+    for (auto const& value : values) {
+      alternatives.push_back(bloomBits(bloomOf(value)));
+    }
+  };
+  add_criterion(q.addresses);
+  for (auto const& topics : q.topics) {
+    add_criterion(topics);
+  }
+  if (criteria.empty()) {
+    criteria.push_back({{c_has_logs_row}});
+  }
+  auto matches_bloom = [&](LogBloom const& bloom) {
+    return std::all_of(criteria.begin(), criteria.end(), [&](auto const& alternatives) {
+      return std::any_of(alternatives.begin(), alternatives.end(),
+                         [&](auto const& bits) { return hasBits(bloom, bits); });
+    });
+  };
+
+  std::vector<BlockNumber> candidates, current_section_candidates;
+  BlockNumber sealed_end = 0;
+  {
+    sharedLock lock(mu_);
+    sealed_end = sealed_sections_ * c_section_size;
+    for (auto it = section_blooms_.lower_bound(std::max(q.from_block, sealed_end));
+         it != section_blooms_.end() && it->first <= q.to_block; ++it) {
+      if (matches_bloom(it->second)) {
+        current_section_candidates.push_back(it->first);
+      }
+    }
+  }
+  for (auto section = q.from_block / c_section_size;
+       section * c_section_size < sealed_end && section * c_section_size <= q.to_block; ++section) {
+    auto const section_begin = section * c_section_size;
+    sectionCandidates(section, std::max(q.from_block, section_begin),
+                      std::min(q.to_block, section_begin + c_section_size - 1), criteria, candidates);
+  }
+  candidates.insert(candidates.end(), current_section_candidates.begin(), current_section_candidates.end());
+
+  // Bloom matches are probable, logs are checked against query
+  static constexpr size_t c_query_chunk_size = 1024;
+  std::vector<LocalisedLog> result;
+  for (size_t chunk_begin = 0; chunk_begin < candidates.size(); chunk_begin += c_query_chunk_size) {
+    auto const chunk_end = std::min(candidates.size(), chunk_begin + c_query_chunk_size);
+    DbStorage::MultiGetQuery db_query(db_, chunk_end - chunk_begin);
+    for (auto i = chunk_begin; i < chunk_end; ++i) {
+      db_query.append(DbStorage::Columns::block_logs, uint64_t(candidates[i]));
+    }
+    auto records = db_query.execute();
+    for (auto i = chunk_begin; i < chunk_end; ++i) {
+      decodeLogs(candidates[i], records[i - chunk_begin], [&](LocalisedLog&& log) {
+        if (q.matches(log.entry)) {
+          result.push_back(std::move(log));
+        }
+      });
+      if (q.max_results && result.size() > q.max_results) {
+        return result;
+      }
+    }
+  }
+  return result;
+}
+
+std::vector<size_t> LogIndex::bloomBits(LogBloom const& bloom) {
+  std::vector<size_t> ret;
+  for (size_t byte = 0; byte < LogBloom::size; ++byte) {
+    for (size_t bit = 0; bit < 8; ++bit) {
+      if (bloom[byte] & (1 << bit)) {
+        ret.push_back(byte * 8 + bit);
+      }
+    }
+  }
+  return ret;
+}
+
+bool LogIndex::hasBits(LogBloom const& bloom, std::vector<size_t> const& bits) {
+  for (auto bit : bits) {
+    // Every block of the current section has logs, c_has_logs_row is not a bloom bit
+    if (bit < c_bloom_bits && !(bloom[bit / 8] & (1 << (bit % 8)))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void LogIndex::sealSection(DbStorage::BatchPtr const& batch, BlockNumber section,
+                           std::map<BlockNumber, LogBloom> const& blooms) {
+  std::vector<std::string> rows(c_rows);
+  auto const section_begin = section * c_section_size;
+  for (auto const& [blk_n, bloom] : blooms) {
+    auto const offset = blk_n - section_begin;
+    auto set_bit = [&](size_t row) {
+      auto& bits = rows[row];
+      if (bits.empty()) {
+        bits.assign(c_section_size / 8, 0);
+      }
+      bits[offset / 8] |= char(1 << (offset % 8));
+    };
+    for (auto bit : bloomBits(bloom)) {
+      set_bit(bit);
+    }
+    set_bit(c_has_logs_row);
+  }
+  // Rows without set bits are not stored
+  for (size_t row = 0; row < c_rows; ++row) {
+    if (!rows[row].empty()) {
+      db_->batch_put(*batch, DbStorage::Columns::log_bloombits, rowKey(section, row), rows[row]);
+    }
+  }
+}
+
+void LogIndex::sectionCandidates(BlockNumber section, BlockNumber from, BlockNumber to,
+                                 std::vector<BitsAlternatives> const& criteria,
+                                 std::vector<BlockNumber>& result) const {
+  std::map<size_t, std::string> rows;
+  for (auto const& alternatives : criteria) {
+    for (auto const& bits : alternatives) {
+      for (auto bit : bits) {
+        rows[bit];
+      }
+    }
+  }
+  DbStorage::MultiGetQuery db_query(db_, rows.size());
+  for (auto const& [row, _] : rows) {
+    db_query.append(DbStorage::Columns::log_bloombits, rowKey(section, row));
+  }
+  auto values = db_query.execute();
+  size_t i = 0;
+  for (auto& [_, bits] : rows) {
+    bits = std::move(values[i++]);
+  }
+
+  using Bits = std::vector<uint8_t>;
+  static constexpr size_t c_row_size = c_section_size / 8;
+  Bits matching(c_row_size, 0xff);
+  for (auto const& alternatives : criteria) {
+    Bits any(c_row_size, 0);
+    for (auto const& bits : alternatives) {
+      Bits all(c_row_size, 0xff);
+      for (auto bit : bits) {
+        auto const& row = rows[bit];
+        for (size_t byte = 0; byte < c_row_size; ++byte) {
+          // Missing row has no bits set
+          all[byte] &= row.empty() ? 0 : uint8_t(row[byte]);
+        }
+      }
+      for (size_t byte = 0; byte < c_row_size; ++byte) {
+        any[byte] |= all[byte];
+      }
+    }
+    for (size_t byte = 0; byte < c_row_size; ++byte) {
+      matching[byte] &= any[byte];
+    }
+  }
+  auto const section_begin = section * c_section_size;
+  for (auto blk_n = from; blk_n <= to; ++blk_n) {
+    auto const offset = blk_n - section_begin;
+    if (matching[offset / 8] & (1 << (offset % 8))) {
+      result.push_back(blk_n);
+    }
+  }
+}
+
+}  // namespace taraxa::final_chain
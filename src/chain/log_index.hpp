@@ -0,0 +1,96 @@
+#pragma once
+
+#include <libethcore/Common.h>
+#include <libethcore/LogEntry.h>
+
+#include <map>
+
+#include "boost/thread.hpp"
+#include "common/types.hpp"
+#include "state_api.hpp"
+#include "storage/db_storage.hpp"
+
+namespace taraxa::final_chain {
+
+struct LogQuery {
+  BlockNumber from_block = 0;
+  BlockNumber to_block = 0;
+  // Log matches if it is emitted by any of addresses and for each position its topic is any of topics[position], empty
+  // list matches everything
+  std::vector<addr_t> addresses;
+  std::vector<std::vector<h256>> topics;
+  // Query stops once more than max_results logs are found, 0 means no limit
+  size_t max_results = 0;
+
+  bool matches(dev::eth::LogEntry const& log) const;
+};
+
+struct LocalisedLog {
+  dev::eth::LogEntry entry;
+  BlockNumber blk_n = 0;
+  h256 blk_hash;
+  h256 trx_hash;
+  uint32_t trx_idx = 0;
+  // Position of log in the block
+  uint32_t log_idx = 0;
+};
+
+/**
+ * Index of logs emitted by executed blocks
+ * 1. block_logs column: logs of block by block number, only blocks with logs are stored
+ * 2. log_bloombits column: bloom bits of blocks rotated per section of c_section_size blocks. For each bloom bit there
+ *    is a row with that bit of every block of the section, so that query reads only rows of bits it looks for. Extra
+ *    row c_has_logs_row marks blocks with any logs. Rows are written once the section is complete, blooms of the
+ *    current section are kept in memory
+ *
+ * Index is written in the same db batch as the block.
+ */
+class LogIndex {
+ public:
+  static constexpr BlockNumber c_section_size = 4096;
+  static constexpr size_t c_bloom_bits = dev::eth::LogBloom::size * 8;
+  static constexpr size_t c_has_logs_row = c_bloom_bits;
+  static constexpr size_t c_rows = c_bloom_bits + 1;
+
+  LogIndex(std::shared_ptr<DbStorage> db, BlockNumber last_blk_n);
+
+  /**
+   * @brief Writes logs of block to batch, in-memory part of the index is updated by confirm() once batch is committed
+   */
+  void append(DbStorage::BatchPtr const& batch, BlockNumber blk_n, h256 const& blk_hash,
+              dev::eth::Transactions const& transactions,
+              std::vector<state_api::ExecutionResult> const& execution_results);
+  void confirm();
+
+  std::vector<LocalisedLog> query(LogQuery const& q) const;
+
+ private:
+  using uLock = boost::unique_lock<boost::shared_mutex>;
+  using sharedLock = boost::shared_lock<boost::shared_mutex>;
+  // Alternatives of bloom bits sets, block matches if it has all bits of any of the sets
+  using BitsAlternatives = std::vector<std::vector<size_t>>;
+
+  static std::vector<size_t> bloomBits(dev::eth::LogBloom const& bloom);
+  static bool hasBits(dev::eth::LogBloom const& bloom, std::vector<size_t> const& bits);
+  static uint64_t rowKey(BlockNumber section, size_t row) { return section * c_rows + row; }
+  void sealSection(DbStorage::BatchPtr const& batch, BlockNumber section,
+                   std::map<BlockNumber, dev::eth::LogBloom> const& blooms);
+  void sectionCandidates(BlockNumber section, BlockNumber from, BlockNumber to,
+                         std::vector<BitsAlternatives> const& criteria, std::vector<BlockNumber>& result) const;
+
+  std::shared_ptr<DbStorage> db_;
+  // Blooms of blocks with logs in the current section
+  std::map<BlockNumber, dev::eth::LogBloom> section_blooms_;
+  // Blocks below sealed_sections_ * c_section_size are in log_bloombits
+  BlockNumber sealed_sections_ = 0;
+  mutable boost::shared_mutex mu_;
+
+  // Owned by the thread appending blocks
+  struct Pending {
+    BlockNumber blk_n = 0;
+    std::optional<dev::eth::LogBloom> bloom;
+  };
+  std::optional<Pending> pending_;
+};
+
+}  // namespace taraxa::final_chain
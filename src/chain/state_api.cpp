@@ -149,6 +149,38 @@ bytes StateAPI::get_code_by_address(BlockNumber blk_num, addr_t const& addr) con
   return c_method_args_rlp<bytes, to_bytes, taraxa_evm_state_api_get_code_by_address>(this_c, blk_num, addr);
 }
 
+// Calls fn for each item with the same encoding buffer and error handler, fn result is decoded into result[i]
+template <typename Result,                            //
+          void (*decode)(taraxa_evm_Bytes, Result&),  //
+          void (*fn)(taraxa_evm_state_API_ptr, taraxa_evm_Bytes, taraxa_evm_BytesCallback,
+                     taraxa_evm_BytesCallback),  //
+          typename Item, typename... Params>
+void c_method_args_rlp_batch(taraxa_evm_state_API_ptr this_c, vector<Item> const& items, vector<Result>& result,
+                             Params const&... args) {
+  result.clear();
+  result.resize(items.size());
+  RLPStream rlp;
+  ErrorHandler err_h;
+  for (size_t i = 0; i < items.size(); ++i) {
+    rlp.clear();
+    enc_rlp_tuple(rlp, args..., items[i]);
+    fn(this_c, map_bytes(rlp.out()), decoder_cb_c<Result, decode>(result[i]), err_h.cgo_part);
+    err_h.check();
+  }
+}
+
+void StateAPI::get_accounts(BlockNumber blk_num, vector<addr_t> const& addrs,
+                            vector<optional<Account>>& result) const {
+  c_method_args_rlp_batch<optional<Account>, from_rlp, taraxa_evm_state_api_get_account>(this_c, addrs, result,
+                                                                                          blk_num);
+}
+
+void StateAPI::get_account_storage(BlockNumber blk_num, addr_t const& addr, vector<u256> const& keys,
+                                   vector<u256>& result) const {
+  c_method_args_rlp_batch<u256, to_u256, taraxa_evm_state_api_get_account_storage>(this_c, keys, result, blk_num,
+                                                                                   addr);
+}
+
 ExecutionResult StateAPI::dry_run_transaction(BlockNumber blk_num, EVMBlock const& blk, EVMTransaction const& trx,
                                               optional<ExecutionOptions> const& opts) const {
   return c_method_args_rlp<ExecutionResult, from_rlp, taraxa_evm_state_api_dry_run_transaction>(this_c, blk_num, blk,
@@ -180,8 +212,9 @@ void StateAPI::transition_state_commit() {
   err_h.check();
 }
 
-void StateAPI::create_snapshot(uint64_t const& period) {
-  auto path = db_path + to_string(period);
+void StateAPI::create_snapshot(uint64_t const& period) { create_checkpoint(db_path + to_string(period)); }
+
+void StateAPI::create_checkpoint(string const& path) {
   GoString go_path;
   go_path.p = path.c_str();
   go_path.n = path.size();
@@ -239,6 +239,11 @@ class StateAPI {
   optional<Account> get_account(BlockNumber blk_num, addr_t const& addr) const;
   u256 get_account_storage(BlockNumber blk_num, addr_t const& addr, u256 const& key) const;
   bytes get_code_by_address(BlockNumber blk_num, addr_t const& addr) const;
+  // Multi-item variants reuse encoding buffer and error handler for all the items, results are written to the passed
+  // buffers. Go state API has no batch entry point, so it is still one call per item
+  void get_accounts(BlockNumber blk_num, vector<addr_t> const& addrs, vector<optional<Account>>& result) const;
+  void get_account_storage(BlockNumber blk_num, addr_t const& addr, vector<u256> const& keys,
+                           vector<u256>& result) const;
   ExecutionResult dry_run_transaction(BlockNumber blk_num, EVMBlock const& blk, EVMTransaction const& trx,
                                       optional<ExecutionOptions> const& opts = nullopt) const;
   StateDescriptor get_last_committed_state_descriptor() const;
@@ -247,6 +252,8 @@ class StateAPI {
                                                 RangeView<UncleBlock> const& uncles = {});
   void transition_state_commit();
   void create_snapshot(uint64_t const& period);
+  // Consistent copy of the state db at the last committed state, path must not exist
+  void create_checkpoint(string const& path);
   // DPOS
   uint64_t dpos_eligible_count(BlockNumber blk_num) const;
   uint64_t dpos_eligible_total_vote_count(BlockNumber blk_num) const;
@@ -0,0 +1,72 @@
+#include "state_cache.hpp"
+
+namespace taraxa::final_chain {
+
+void StateCache::onNewBlock(BlockNumber last_blk_n) {
+  uLock lock(mu_);
+  last_blk_n_ = last_blk_n;
+  while (!blocks_cache_.empty() && blocks_cache_.begin()->first + blocks_ <= last_blk_n) {
+    eraseBlock(blocks_cache_.begin());
+  }
+}
+
+void StateCache::clear() {
+  uLock lock(mu_);
+  blocks_cache_.clear();
+  size_bytes_ = 0;
+  entries_ = 0;
+}
+
+StateCache::Stats StateCache::stats() const {
+  Stats ret;
+  ret.hits = hits_;
+  ret.misses = misses_;
+  sharedLock lock(mu_);
+  ret.size_bytes = size_bytes_;
+  ret.entries = entries_;
+  return ret;
+}
+
+size_t StateCache::entrySize(std::string const& key, Value const& value) {
+  // Rough estimate of hash map node and heap allocations
+  static constexpr size_t c_node_overhead = 64;
+  size_t ret = c_node_overhead + sizeof(Value) + key.capacity();
+  if (auto code = std::get_if<bytes>(&value)) {
+    ret += code->capacity();
+  } else if (auto dpos = std::get_if<state_api::DPOSQueryResult>(&value)) {
+    for (auto const& [_, account] : dpos->account_results) {
+      ret += c_node_overhead + sizeof(account) +
+             (account.inbound_deposits.size() + account.outbound_deposits.size()) * (c_node_overhead + 64);
+    }
+  }
+  return ret;
+}
+
+void StateCache::put(BlockNumber blk_n, std::string key, Value value) {
+  auto const size = entrySize(key, value);
+  uLock lock(mu_);
+  // Queries of blocks that are already dropped
+  if (blk_n + blocks_ <= last_blk_n_) {
+    return;
+  }
+  while (max_size_bytes_ < size_bytes_ + size && !blocks_cache_.empty() && blocks_cache_.begin()->first < blk_n) {
+    eraseBlock(blocks_cache_.begin());
+  }
+  if (max_size_bytes_ < size_bytes_ + size) {
+    return;
+  }
+  auto& block = blocks_cache_[blk_n];
+  if (block.entries.emplace(std::move(key), std::move(value)).second) {
+    block.size_bytes += size;
+    size_bytes_ += size;
+    ++entries_;
+  }
+}
+
+void StateCache::eraseBlock(std::map<BlockNumber, Block>::iterator it) {
+  size_bytes_ -= it->second.size_bytes;
+  entries_ -= it->second.entries.size();
+  blocks_cache_.erase(it);
+}
+
+}  // namespace taraxa::final_chain
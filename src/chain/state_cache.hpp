@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <variant>
+
+#include "boost/thread.hpp"
+#include "state_api.hpp"
+
+namespace taraxa::final_chain {
+
+/**
+ * Read-through cache of state queries keyed by block number. State of a block never changes, so entries are never
+ * stale, old blocks are dropped by onNewBlock() as queries move to the latest block.
+ *
+ * Memory usage is approximate, when limit is reached entries of the oldest blocks are dropped, and if it is still
+ * reached new entries are not cached.
+ */
+class StateCache {
+ public:
+  struct Opts {
+    size_t max_size_mb = 64;
+    // Number of the most recent blocks which states are cached
+    BlockNumber blocks = 4;
+  };
+
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t size_bytes = 0;
+    size_t entries = 0;
+  };
+
+  using Value = std::variant<std::optional<state_api::Account>, u256, bytes, state_api::DPOSQueryResult>;
+
+  explicit StateCache(Opts const& opts) : max_size_bytes_(opts.max_size_mb * 1024 * 1024), blocks_(opts.blocks) {}
+
+  /**
+   * @param key query kind and parameters, unique per query kind
+   * @param load queries state, it is not cached if it throws
+   */
+  template <typename T, typename Load>
+  T get(BlockNumber blk_n, std::string key, Load const& load) {
+    if (auto cached = lookup<T>(blk_n, key)) {
+      return std::move(*cached);
+    }
+    T ret = load();
+    put(blk_n, std::move(key), ret);
+    return ret;
+  }
+
+  template <typename T>
+  std::optional<T> lookup(BlockNumber blk_n, std::string const& key) {
+    {
+      sharedLock lock(mu_);
+      if (auto blk_it = blocks_cache_.find(blk_n); blk_it != blocks_cache_.end()) {
+        if (auto it = blk_it->second.entries.find(key); it != blk_it->second.entries.end()) {
+          ++hits_;
+          return std::get<T>(it->second);
+        }
+      }
+    }
+    ++misses_;
+    return std::nullopt;
+  }
+
+  void put(BlockNumber blk_n, std::string key, Value value);
+  void onNewBlock(BlockNumber last_blk_n);
+  void clear();
+  Stats stats() const;
+
+ private:
+  using uLock = boost::unique_lock<boost::shared_mutex>;
+  using sharedLock = boost::shared_lock<boost::shared_mutex>;
+  struct Block {
+    std::unordered_map<std::string, Value> entries;
+    size_t size_bytes = 0;
+  };
+
+  static size_t entrySize(std::string const& key, Value const& value);
+  void eraseBlock(std::map<BlockNumber, Block>::iterator it);
+
+  size_t const max_size_bytes_;
+  BlockNumber const blocks_;
+  std::map<BlockNumber, Block> blocks_cache_;
+  size_t size_bytes_ = 0;
+  size_t entries_ = 0;
+  BlockNumber last_blk_n_ = 0;
+  mutable boost::shared_mutex mu_;
+
+  std::atomic<uint64_t> hits_ = 0;
+  std::atomic<uint64_t> misses_ = 0;
+};
+
+}  // namespace taraxa::final_chain
@@ -0,0 +1,41 @@
+#include "state_call_pool.hpp"
+
+#include <future>
+
+namespace taraxa::final_chain {
+
+StateCallPool::StateCallPool(std::shared_ptr<FinalChain> final_chain, Opts const& opts)
+    : final_chain_(std::move(final_chain)), opts_(opts), pool_(std::max<size_t>(opts.threads, 1)) {}
+
+state_api::ExecutionResult StateCallPool::call(state_api::EVMTransaction trx, std::optional<BlockNumber> blk_n,
+                                               state_api::ExecutionOptions const& opts) {
+  if (opts_.gas_cap && (!trx.Gas || opts_.gas_cap < trx.Gas)) {
+    trx.Gas = opts_.gas_cap;
+  }
+  // Call is bound to the block committed at the time of request, even if it waits while next blocks are executed
+  auto const n = blk_n ? *blk_n : final_chain_->last_block_number();
+  if (opts_.max_queued <= queued_++) {
+    --queued_;
+    throw ErrCallRejected("Too many pending calls");
+  }
+  auto expired = std::make_shared<std::atomic<bool>>(false);
+  auto task = std::make_shared<std::packaged_task<state_api::ExecutionResult()>>(
+      [this, expired, n, opts, trx = std::move(trx)] {
+        --queued_;
+        // Caller is not waiting anymore
+        if (*expired) {
+          return state_api::ExecutionResult();
+        }
+        return final_chain_->call(trx, n, opts);
+      });
+  auto result = task->get_future();
+  pool_.post([task] { (*task)(); });
+  if (opts_.timeout_ms &&
+      result.wait_for(std::chrono::milliseconds(opts_.timeout_ms)) == std::future_status::timeout) {
+    *expired = true;
+    throw ErrCallRejected("Call timed out after " + std::to_string(opts_.timeout_ms) + "ms");
+  }
+  return result.get();
+}
+
+}  // namespace taraxa::final_chain
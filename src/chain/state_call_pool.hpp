@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <stdexcept>
+
+#include "final_chain.hpp"
+#include "util/thread_pool.hpp"
+
+namespace taraxa::final_chain {
+
+struct ErrCallRejected : std::runtime_error {
+  using runtime_error::runtime_error;
+};
+
+/**
+ * Runs dry runs of transactions (eth_call, eth_estimateGas) on its own threads, so that client calls run in parallel
+ * with each other and their load is bounded, while block execution is not waiting for them. Calls read state of
+ * committed blocks only.
+ */
+class StateCallPool {
+ public:
+  struct Opts {
+    size_t threads = 4;
+    // Calls waiting for a free thread, calls above the limit are rejected
+    size_t max_queued = 1024;
+    // Gas of calls without gas limit or with a greater one is capped
+    uint64_t gas_cap = 50'000'000;
+    // Call not completed in time fails, 0 means no limit. EVM can't be interrupted, so running call completes in
+    // background and keeps its thread busy
+    uint64_t timeout_ms = 5000;
+  };
+
+  StateCallPool(std::shared_ptr<FinalChain> final_chain, Opts const& opts);
+
+  /**
+   * @brief Dry runs transaction on the state of block blk_n, latest committed block if it is not set
+   * @throws ErrCallRejected when too many calls are queued or call timed out
+   */
+  state_api::ExecutionResult call(state_api::EVMTransaction trx, std::optional<BlockNumber> blk_n,
+                                  state_api::ExecutionOptions const& opts);
+
+ private:
+  std::shared_ptr<FinalChain> final_chain_;
+  Opts const opts_;
+  std::atomic<size_t> queued_ = 0;
+  util::ThreadPool pool_;
+};
+
+}  // namespace taraxa::final_chain
+
+namespace taraxa {
+using final_chain::StateCallPool;
+}
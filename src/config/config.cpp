@@ -106,10 +106,14 @@ FullNodeConfig::FullNodeConfig(Json::Value const &string_or_object,
   network.network_transaction_interval = getConfigDataAsUInt(root, {"network_transaction_interval"});
   network.network_min_dag_block_broadcast = getConfigDataAsUInt(root, {"network_min_dag_block_broadcast"}, true, 5);
   network.network_max_dag_block_broadcast = getConfigDataAsUInt(root, {"network_max_dag_block_broadcast"}, true, 20);
+  network.network_min_transaction_broadcast = getConfigDataAsUInt(root, {"network_min_transaction_broadcast"}, true, 1);
+  network.network_max_transaction_broadcast =
+      getConfigDataAsUInt(root, {"network_max_transaction_broadcast"}, true, 10);
   network.network_bandwidth = getConfigDataAsUInt(root, {"network_bandwidth"});
   network.network_ideal_peer_count = getConfigDataAsUInt(root, {"network_ideal_peer_count"});
   network.network_max_peer_count = getConfigDataAsUInt(root, {"network_max_peer_count"});
   network.network_sync_level_size = getConfigDataAsUInt(root, {"network_sync_level_size"});
+  network.network_pbft_sync_peers = getConfigDataAsUInt(root, {"network_pbft_sync_peers"}, true, 4);
   for (auto &item : root["network_boot_nodes"]) {
     NodeConfig node;
     node.id = getConfigDataAsString(item, {"id"});
@@ -139,6 +143,54 @@ FullNodeConfig::FullNodeConfig(Json::Value const &string_or_object,
     if (auto threads_num = getConfigData(rpc_config, {"threads_num"}, true); !threads_num.isNull()) {
       rpc->threads_num = threads_num.asUInt();
     }
+
+    // max number of transactions in one batch submission
+    if (auto max_batch = getConfigData(rpc_config, {"max_raw_transactions_batch"}, true); !max_batch.isNull()) {
+      rpc->max_raw_transactions_batch = max_batch.asUInt();
+    }
+
+    // eth_getLogs limits
+    if (auto range = getConfigData(rpc_config, {"max_logs_block_range"}, true); !range.isNull()) {
+      rpc->max_logs_block_range = range.asUInt64();
+    }
+    if (auto max_logs = getConfigData(rpc_config, {"max_logs_results"}, true); !max_logs.isNull()) {
+      rpc->max_logs_results = max_logs.asUInt();
+    }
+  }
+
+  {
+    TransactionPoolConfig const defaults;
+    transaction_pool.max_transactions =
+        getConfigDataAsUInt(root, {"transaction_pool", "max_transactions"}, true, defaults.max_transactions);
+    transaction_pool.max_size_mb =
+        getConfigDataAsUInt(root, {"transaction_pool", "max_size_mb"}, true, defaults.max_size_mb);
+    transaction_pool.max_transactions_per_sender = getConfigDataAsUInt(
+        root, {"transaction_pool", "max_transactions_per_sender"}, true, defaults.max_transactions_per_sender);
+    transaction_pool.price_bump_percent =
+        getConfigDataAsUInt(root, {"transaction_pool", "price_bump_percent"}, true, defaults.price_bump_percent);
+  }
+
+  {
+    ExecutorConfig const defaults;
+    executor.sync_each_n_periods =
+        getConfigDataAsUInt(root, {"executor", "sync_each_n_periods"}, true, defaults.sync_each_n_periods);
+    executor.sync_interval_ms =
+        getConfigDataAsUInt(root, {"executor", "sync_interval_ms"}, true, defaults.sync_interval_ms);
+  }
+
+  {
+    StateCallPool::Opts const defaults;
+    eth_call.threads = getConfigDataAsUInt(root, {"eth_call", "threads"}, true, defaults.threads);
+    eth_call.max_queued = getConfigDataAsUInt(root, {"eth_call", "max_queued"}, true, defaults.max_queued);
+    eth_call.gas_cap = getConfigDataAsUInt(root, {"eth_call", "gas_cap"}, true, defaults.gas_cap);
+    eth_call.timeout_ms = getConfigDataAsUInt(root, {"eth_call", "timeout_ms"}, true, defaults.timeout_ms);
+  }
+
+  {
+    final_chain::StateCache::Opts const defaults;
+    auto &state_cache = opts_final_chain.state_cache;
+    state_cache.max_size_mb = getConfigDataAsUInt(root, {"state_cache", "max_size_mb"}, true, defaults.max_size_mb);
+    state_cache.blocks = getConfigDataAsUInt(root, {"state_cache", "blocks"}, true, defaults.blocks);
   }
 
   {  // for test experiments
@@ -266,6 +318,7 @@ std::ostream &operator<<(std::ostream &strm, NetworkConfig const &conf) {
   strm << "  network_ideal_peer_count: " << conf.network_ideal_peer_count << std::endl;
   strm << "  network_max_peer_count: " << conf.network_max_peer_count << std::endl;
   strm << "  network_sync_level_size: " << conf.network_sync_level_size << std::endl;
+  strm << "  network_pbft_sync_peers: " << conf.network_pbft_sync_peers << std::endl;
   strm << "  network_id: " << conf.network_id << std::endl;
 
   strm << "  --> boot nodes  ... " << std::endl;
@@ -3,6 +3,7 @@
 #include <string>
 
 #include "chain/chain_config.hpp"
+#include "chain/state_call_pool.hpp"
 #include "common/types.hpp"
 #include "config/config_exception.hpp"
 #include "dag/dag_block.hpp"
@@ -18,6 +19,13 @@ struct RpcConfig {
 
   // Number of threads dedicated to the rpc calls processing, default = 5
   uint16_t threads_num{5};
+
+  // Max number of transactions in one taraxa_sendRawTransactions call
+  uint32_t max_raw_transactions_batch = 1000;
+
+  // Max number of blocks and logs in one eth_getLogs call, 0 means no limit
+  uint64_t max_logs_block_range = 10000;
+  uint32_t max_logs_results = 10000;
 };
 
 struct NodeConfig {
@@ -39,7 +47,11 @@ struct NetworkConfig {
   uint16_t network_transaction_interval = 0;
   uint16_t network_min_dag_block_broadcast = 0;
   uint16_t network_max_dag_block_broadcast = 0;
+  uint16_t network_min_transaction_broadcast = 0;
+  uint16_t network_max_transaction_broadcast = 0;
   uint16_t network_sync_level_size = 0;
+  // Peers PBFT blocks are synced from at the same time
+  uint16_t network_pbft_sync_peers = 4;
   uint64_t network_id;
   uint16_t network_performance_log_interval = 0;
   uint16_t network_num_threads = max(uint(1), uint(std::thread::hardware_concurrency() / 2));
@@ -50,6 +62,26 @@ struct BlockProposerConfig {
   uint16_t transaction_limit = 0;
 };
 
+// Transaction pool limits, 0 means no limit
+struct TransactionPoolConfig {
+  uint32_t max_transactions = 200000;
+  uint32_t max_size_mb = 512;
+  uint32_t max_transactions_per_sender = 0;
+  // Min gas price increase (in percents) for replacing pending transaction with the same sender and nonce
+  uint32_t price_bump_percent = 10;
+};
+
+struct ExecutorConfig {
+  // Durability of executed periods. Db write of a period is synced when sync_each_n_periods periods or
+  // sync_interval_ms milliseconds passed since the last sync, 0 disables the respective condition. Unsynced periods
+  // are also synced sync_interval_ms after the last sync if no other period is executed. With both 0 writes are synced
+  // only on executor start and stop and durability relies on WAL: nothing is lost on process crash, OS crash might
+  // lose periods not yet flushed by OS, those are executed again from PBFT chain on restart. Unless every period is
+  // synced state db is checkpointed on each sync, state db ahead of the synced periods is restored from the checkpoint
+  uint32_t sync_each_n_periods = 1;
+  uint32_t sync_interval_ms = 0;
+};
+
 // Parameter Tuning purpose
 struct TestParamsConfig {
   BlockProposerConfig block_proposer;  // test_params.block_proposer
@@ -79,6 +111,10 @@ struct FullNodeConfig {
   fs::path db_path;
   NetworkConfig network;
   optional<RpcConfig> rpc;
+  TransactionPoolConfig transaction_pool;
+  ExecutorConfig executor;
+  // Limits of eth_call and eth_estimateGas
+  StateCallPool::Opts eth_call;
   TestParamsConfig test_params;
   ChainConfig chain = ChainConfig::predefined();
   FinalChain::Opts opts_final_chain;
@@ -130,20 +130,23 @@ bool BlockProposer::getLatestPivotAndTips(blk_hash_t& pivot, vec_blk_t& tips) {
 }
 
 bool BlockProposer::getShardedTrxs(vec_trx_t& sharded_trxs) {
-  vec_trx_t to_be_packed_trx;
-  trx_mgr_->packTrxs(to_be_packed_trx, bp_config_.transaction_limit);
+  // Shard by sender so that nonce ordered transactions of one sender are packed by the same proposer, transactions
+  // from other shards stay in the queue
+  PendingTransactionPool::NonceGetter state_nonce;
+  if (state_nonce_check_ && final_chain_) {
+    state_nonce = [this](addr_t const& sender) -> std::optional<uint64_t> {
+      auto account = final_chain_->get_account(sender);
+      return account ? account->Nonce : 0;
+    };
+  }
+  trx_mgr_->packTrxs(
+      sharded_trxs, bp_config_.transaction_limit,
+      [this](addr_t const& sender) {
+        auto shard = std::stoull(sender.toString().substr(0, 10), NULL, 16);
+        return shard % total_trx_shards_ == my_trx_shard_;
+      },
+      state_nonce);
 
-  if (to_be_packed_trx.empty()) {
-    LOG(log_tr_) << "Skip block proposer, zero unpacked transactions ..." << std::endl;
-    return false;
-  }
-  sharded_trxs.clear();
-  for (auto const& t : to_be_packed_trx) {
-    auto shard = std::stoull(t.toString().substr(0, 10), NULL, 16);
-    if (shard % total_trx_shards_ == my_trx_shard_) {
-      sharded_trxs.emplace_back(t);
-    }
-  }
   if (sharded_trxs.empty()) {
     LOG(log_tr_) << "Skip block proposer, zero sharded transactions ..." << std::endl;
     return false;
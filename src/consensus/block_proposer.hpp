@@ -72,12 +72,13 @@ class BlockProposer : public std::enable_shared_from_this<BlockProposer> {
   BlockProposer(BlockProposerConfig const& bp_config, vdf_sortition::VdfConfig const& vdf_config,
                 std::shared_ptr<DagManager> dag_mgr, std::shared_ptr<TransactionManager> trx_mgr,
                 std::shared_ptr<DagBlockManager> dag_blk_mgr, std::shared_ptr<FinalChain> final_chain, addr_t node_addr,
-                secret_t node_sk, vrf_sk_t vrf_sk, logger::Logger log_time)
+                secret_t node_sk, vrf_sk_t vrf_sk, logger::Logger log_time, bool state_nonce_check = true)
       : bp_config_(bp_config),
         dag_mgr_(dag_mgr),
         trx_mgr_(trx_mgr),
         dag_blk_mgr_(dag_blk_mgr),
         final_chain_(final_chain),
+        state_nonce_check_(state_nonce_check),
         log_time_(log_time),
         node_addr_(node_addr),
         node_sk_(node_sk),
@@ -86,7 +87,7 @@ class BlockProposer : public std::enable_shared_from_this<BlockProposer> {
     propose_model_ = std::make_unique<SortitionPropose>(vdf_config, node_addr, dag_mgr, trx_mgr);
     total_trx_shards_ = std::max((unsigned int)bp_config_.shard, 1u);
     auto addr = std::stoull(node_addr.toString().substr(0, 6).c_str(), NULL, 16);
-    my_trx_shard_ = addr % bp_config_.shard;
+    my_trx_shard_ = addr % total_trx_shards_;
     LOG(log_nf_) << "Block proposer in " << my_trx_shard_ << " shard ...";
   }
 
@@ -119,6 +120,8 @@ class BlockProposer : public std::enable_shared_from_this<BlockProposer> {
   std::shared_ptr<TransactionManager> trx_mgr_;
   std::shared_ptr<DagBlockManager> dag_blk_mgr_;
   std::shared_ptr<FinalChain> final_chain_;
+  // Transactions are packed only in sender's nonce order without gaps, disabled if chain does not check nonces
+  bool const state_nonce_check_;
   std::shared_ptr<std::thread> proposer_worker_;
   std::unique_ptr<ProposeModelFace> propose_model_;
   std::weak_ptr<Network> network_;
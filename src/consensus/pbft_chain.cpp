@@ -111,9 +111,7 @@ PbftBlockCert::PbftBlockCert(PbftBlock const& pbft_blk, std::vector<Vote> const&
 
 PbftBlockCert::PbftBlockCert(dev::RLP const& rlp) {
   pbft_blk.reset(new PbftBlock(rlp[0]));
-  for (auto const& el : rlp[1]) {
-    cert_votes.emplace_back(el);
-  }
+  cert_votes = decodeCertVotes(pbft_blk->getBlockHash(), rlp[1]);
 }
 
 PbftBlockCert::PbftBlockCert(bytes const& all_rlp) : PbftBlockCert(dev::RLP(all_rlp)) {}
@@ -121,10 +119,7 @@ PbftBlockCert::PbftBlockCert(bytes const& all_rlp) : PbftBlockCert(dev::RLP(all_
 bytes PbftBlockCert::rlp() const {
   RLPStream s(2);
   s.appendRaw(pbft_blk->rlp(true));
-  s.appendList(cert_votes.size());
-  for (auto const& v : cert_votes) {
-    s.appendRaw(v.rlp(true));
-  }
+  s.appendRaw(encodeCertVotes(pbft_blk->getBlockHash(), cert_votes));
   return s.out();
 }
 
@@ -337,12 +332,23 @@ void PbftChain::pushUnverifiedPbftBlock(std::shared_ptr<PbftBlock> const& pbft_b
 }
 
 std::string PbftChain::getJsonStr() const {
+  uint64_t size;
+  blk_hash_t last_pbft_block_hash;
+  {
+    sharedLock_ lock(chain_head_access_);
+    size = size_;
+    last_pbft_block_hash = last_pbft_block_hash_;
+  }
+  return getJsonStr(size, last_pbft_block_hash);
+}
+
+std::string PbftChain::getJsonStr(uint64_t size, blk_hash_t const& last_pbft_block_hash) const {
   Json::Value json;
   sharedLock_ lock(chain_head_access_);
   json["head_hash"] = head_hash_.toString();
   json["dag_genesis_hash"] = dag_genesis_hash_.toString();
-  json["size"] = (Json::Value::UInt64)size_;
-  json["last_pbft_block_hash"] = last_pbft_block_hash_.toString();
+  json["size"] = (Json::Value::UInt64)size;
+  json["last_pbft_block_hash"] = last_pbft_block_hash.toString();
   return json.toStyledString();
 }
 
@@ -384,6 +390,11 @@ PbftBlockCert PbftChain::pbftSyncedQueueBack() const {
   return pbft_synced_queue_.back();
 }
 
+PbftBlockCert PbftChain::pbftSyncedQueueAt(size_t index) const {
+  sharedLock_ lock(sync_access_);
+  return pbft_synced_queue_.at(index);
+}
+
 void PbftChain::pbftSyncedQueuePopFront() {
   pbftSyncedSetErase_();
   uniqueLock_ lock(sync_access_);
@@ -29,6 +29,8 @@ class Vote;
 
 enum PbftVoteTypes { propose_vote_type = 0, soft_vote_type, cert_vote_type, next_vote_type };
 
+enum PbftStates { value_proposal_state = 1, filter_state, certify_state, finish_state, finish_polling_state };
+
 class PbftBlock {
   blk_hash_t block_hash_;
   blk_hash_t prev_block_hash_;
@@ -47,6 +49,8 @@ class PbftBlock {
 
   blk_hash_t sha3(bool include_sig) const;
   std::string getJsonStr() const;
+  // Json of the chain with another size and last block, e.g. after the blocks of a batch which is not committed yet
+  std::string getJsonStr(uint64_t size, blk_hash_t const& last_pbft_block_hash) const;
   Json::Value getJson() const;
   void streamRLP(dev::RLPStream& strm, bool include_sig) const;
   bytes rlp(bool include_sig) const;
@@ -90,6 +94,8 @@ class PbftChain {
   std::vector<PbftBlockCert> getPbftBlocks(size_t period, size_t count);
   std::vector<std::string> getPbftBlocksStr(size_t period, size_t count, bool hash) const;  // Remove
   std::string getJsonStr() const;
+  // Json of the chain with another size and last block, e.g. after the blocks of a batch which is not committed yet
+  std::string getJsonStr(uint64_t size, blk_hash_t const& last_pbft_block_hash) const;
 
   bool findPbftBlockInChain(blk_hash_t const& pbft_block_hash);
   bool findUnverifiedPbftBlock(blk_hash_t const& pbft_block_hash) const;
@@ -108,6 +114,7 @@ class PbftChain {
   bool pbftSyncedQueueEmpty() const;
   PbftBlockCert pbftSyncedQueueFront() const;
   PbftBlockCert pbftSyncedQueueBack() const;
+  PbftBlockCert pbftSyncedQueueAt(size_t index) const;
   void pbftSyncedQueuePopFront();
   void setSyncedPbftBlockIntoQueue(PbftBlockCert const& pbft_block_and_votes);
   void clearSyncedPbftBlocks();
@@ -102,8 +102,18 @@ void PbftManager::run() {
   // Initialize PBFT status
   initialState_();
 
+  // Steps polling for votes act on events right away, other steps only check for a new round until their timer fires
+  bool step_time_reached = true;
+  bool polling_step = false;
   while (!stopped_) {
+    metrics_.onStep(state_, getPbftRound(), step_);
     if (stateOperations_()) {
+      step_time_reached = true;
+      continue;
+    }
+    if (!step_time_reached && !polling_step) {
+      // Every vote wakes the loop up, votes of a burst are handled by a single pass of state operations
+      step_time_reached = sleep_(MIN_WAKE_UP_INTERVAL_ms);
       continue;
     }
 
@@ -129,11 +139,22 @@ void PbftManager::run() {
         assert(false);
     }
 
+    auto const step = step_;
     setNextState_();
-    sleep_();
+    metrics_.onStep(state_, getPbftRound(), step_);
+    polling_step = step_ == step && (state_ == certify_state || state_ == finish_polling_state);
+    step_time_reached = sleep_();
   }
 }
 
+void PbftManager::wakeUp() {
+  {
+    std::unique_lock<std::mutex> lock(stop_mtx_);
+    wake_up_ = true;
+  }
+  stop_cv_.notify_all();
+}
+
 std::pair<bool, uint64_t> PbftManager::getDagBlockPeriod(blk_hash_t const &hash) {
   std::pair<bool, uint64_t> res;
   auto value = db_->getDagBlockPeriod(hash);
@@ -164,22 +185,26 @@ void PbftManager::setSortitionThreshold(size_t const sortition_threshold) {
   sortition_threshold_ = sortition_threshold;
 }
 
+bool PbftManager::tryUpdateDposState_(uint64_t pbft_chain_size) {
+  dpos_period_ = pbft_chain_size;
+  try {
+    dpos_votes_count_ = final_chain_->dpos_eligible_total_vote_count(dpos_period_);
+    weighted_votes_count_ = final_chain_->dpos_eligible_vote_count(dpos_period_, node_addr_);
+  } catch (state_api::ErrFutureBlock &c) {
+    LOG(log_er_) << c.what();
+    LOG(log_nf_) << "PBFT period " << dpos_period_ << " is too far ahead of DPOS, need wait! PBFT chain size "
+                 << pbft_chain_size << ", have executed chain size "
+                 << final_chain_->last_block_number();
+    return false;
+  }
+  return true;
+}
+
 void PbftManager::update_dpos_state_() {
-  dpos_period_ = pbft_chain_->getPbftChainSize();
-  do {
-    try {
-      dpos_votes_count_ = final_chain_->dpos_eligible_total_vote_count(dpos_period_);
-      weighted_votes_count_ = final_chain_->dpos_eligible_vote_count(dpos_period_, node_addr_);
-      break;
-    } catch (state_api::ErrFutureBlock &c) {
-      LOG(log_er_) << c.what();
-      LOG(log_nf_) << "PBFT period " << dpos_period_ << " is too far ahead of DPOS, need wait! PBFT chain size "
-                   << pbft_chain_->getPbftChainSize() << ", have executed chain size "
-                   << final_chain_->last_block_number();
-      // Sleep one PBFT lambda time
-      thisThreadSleepForMilliSeconds(LAMBDA_ms);
-    }
-  } while (!stopped_);
+  while (!tryUpdateDposState_(pbft_chain_->getPbftChainSize()) && !stopped_) {
+    // Sleep one PBFT lambda time
+    thisThreadSleepForMilliSeconds(LAMBDA_ms);
+  }
 
   LOG(log_nf_) << "DPOS total votes count is " << dpos_votes_count_ << " for period " << dpos_period_ << ". Account "
                << node_addr_ << " has " << weighted_votes_count_ << " weighted votes";
@@ -291,21 +316,32 @@ bool PbftManager::resetRound_() {
   return restart;
 }
 
-void PbftManager::sleep_() {
+bool PbftManager::sleep_(u_long min_sleep_ms) {
   now_ = std::chrono::system_clock::now();
   duration_ = now_ - round_clock_initial_datetime_;
   elapsed_time_in_round_ms_ = std::chrono::duration_cast<std::chrono::milliseconds>(duration_).count();
   LOG(log_tr_) << "elapsed time in round(ms): " << elapsed_time_in_round_ms_;
+  std::unique_lock<std::mutex> lock(stop_mtx_);
   // Add 25ms for practical reality that a thread will not stall for less than 10-25 ms...
   if (next_step_time_ms_ > elapsed_time_in_round_ms_ + 25) {
     auto time_to_sleep_for_ms = next_step_time_ms_ - elapsed_time_in_round_ms_;
     LOG(log_tr_) << "Time to sleep(ms): " << time_to_sleep_for_ms << " in round " << getPbftRound() << ", step "
                  << step_;
-    std::unique_lock<std::mutex> lock(stop_mtx_);
-    stop_cv_.wait_for(lock, std::chrono::milliseconds(time_to_sleep_for_ms));
+    auto const step_time = std::chrono::steady_clock::now() + std::chrono::milliseconds(time_to_sleep_for_ms);
+    if (min_sleep_ms) {
+      stop_cv_.wait_for(lock, std::chrono::milliseconds(std::min(min_sleep_ms, time_to_sleep_for_ms)),
+                        [this] { return stopped_.load(); });
+    }
+    if (stop_cv_.wait_until(lock, step_time, [this] { return wake_up_ || stopped_; })) {
+      LOG(log_tr_) << "Woken up before step timer in round " << getPbftRound() << ", step " << step_;
+      wake_up_ = false;
+      return false;
+    }
   } else {
     LOG(log_tr_) << "Skipping sleep, running late...";
   }
+  wake_up_ = false;
+  return true;
 }
 
 void PbftManager::initialState_() {
@@ -412,7 +448,7 @@ void PbftManager::setNextState_() {
       if (go_finish_state_) {
         setFinishState_();
       } else {
-        next_step_time_ms_ += POLLING_INTERVAL_ms;
+        next_step_time_ms_ = elapsed_time_in_round_ms_ + POLLING_INTERVAL_ms;
       }
       break;
     case finish_state:
@@ -422,7 +458,7 @@ void PbftManager::setNextState_() {
       if (loop_back_finish_state_) {
         loopBackFinishState_();
       } else {
-        next_step_time_ms_ += POLLING_INTERVAL_ms;
+        next_step_time_ms_ = elapsed_time_in_round_ms_ + POLLING_INTERVAL_ms;
       }
       break;
     default:
@@ -512,20 +548,20 @@ bool PbftManager::stateOperations_() {
   LOG(log_tr_) << "PBFT current round is " << round;
   LOG(log_tr_) << "PBFT current step is " << step_;
 
-  // Get votes
-  votes_ = vote_mgr_->getVerifiedVotes(round, sortition_threshold_, getDposTotalVotesCount(),
-                                       [this](auto const &addr) { return dpos_eligible_vote_count_(addr); });
+  // Verify new votes, they are counted by vote manager index as they are added
+  vote_mgr_->verifyVotes(round, sortition_threshold_, getDposTotalVotesCount(),
+                         [this](auto const &addr) { return dpos_eligible_vote_count_(addr); });
 
-  LOG(log_tr_) << "There are " << votes_.size() << " total votes in round " << round;
+  LOG(log_tr_) << "There are " << vote_mgr_->getVerifiedVotesSize() << " total votes in round " << round;
 
   // CHECK IF WE HAVE RECEIVED 2t+1 CERT VOTES FOR A BLOCK IN OUR CURRENT
   // ROUND.  IF WE HAVE THEN WE EXECUTE THE BLOCK
   // ONLY CHECK IF HAVE *NOT* YET EXECUTED THIS ROUND...
   if (state_ == certify_state && !have_executed_this_round_) {
-    std::vector<Vote> cert_votes_for_round = getVotesOfTypeFromVotesForRoundAndStep_(
-        cert_vote_type, votes_, round, 3, std::make_pair(NULL_BLOCK_HASH, false));
-    std::pair<blk_hash_t, bool> cert_voted_block_hash = blockWithEnoughVotes_(cert_votes_for_round);
+    std::pair<blk_hash_t, bool> cert_voted_block_hash = blockWithEnoughVotes_(cert_vote_type, round, 3);
     if (cert_voted_block_hash.second) {
+      auto cert_votes_for_round =
+          vote_mgr_->getVerifiedVotesOfType(cert_vote_type, round, 3, cert_voted_block_hash.first);
       LOG(log_dg_) << "PBFT block " << cert_voted_block_hash.first << " has enough certed votes";
       // put pbft block into chain
       if (pushCertVotedPbftBlockIntoChain_(cert_voted_block_hash.first, cert_votes_for_round)) {
@@ -622,7 +658,7 @@ void PbftManager::identifyBlock_() {
   if (round == 1 || pbft_chain_->findPbftBlockInChain(voted_value) ||
       (round >= 2 && previous_round_next_votes_->haveEnoughVotesForNullBlockHash())) {
     // Identity leader
-    std::pair<blk_hash_t, bool> leader_block = identifyLeaderBlock_(votes_);
+    std::pair<blk_hash_t, bool> leader_block = identifyLeaderBlock_();
     if (leader_block.second) {
       db_->savePbftMgrVotedValue(PbftMgrVotedValue::own_starting_value_in_round, leader_block.first);
       own_starting_value_for_round_ = leader_block.first;
@@ -659,15 +695,17 @@ void PbftManager::certifyBlock_() {
     LOG(log_tr_) << "In step 3";
 
     if (!soft_voted_block_for_this_round_.second) {
-      auto soft_votes = getVotesOfTypeFromVotesForRoundAndStep_(soft_vote_type, votes_, round, 2,
-                                                                std::make_pair(NULL_BLOCK_HASH, false));
-      auto soft_voted_block_hash = blockWithEnoughVotes_(soft_votes);
+      auto soft_voted_block_hash = blockWithEnoughVotes_(soft_vote_type, round, 2);
+      std::vector<Vote> soft_votes;
+      if (soft_voted_block_hash.second && soft_voted_block_hash.first != NULL_BLOCK_HASH) {
+        soft_votes = vote_mgr_->getVerifiedVotesOfType(soft_vote_type, round, 2);
+      }
 
       auto batch = db_->createWriteBatch();
       db_->addPbftMgrVotedValueToBatch(PbftMgrVotedValue::soft_voted_block_hash_in_round, soft_voted_block_hash.first,
                                        batch);
       db_->addPbftMgrStatusToBatch(PbftMgrStatus::soft_voted_block_in_round, soft_voted_block_hash.second, batch);
-      if (soft_voted_block_hash.second && soft_voted_block_hash.first != NULL_BLOCK_HASH) {
+      if (!soft_votes.empty()) {
         db_->addSoftVotesToBatch(round, soft_votes, batch);
       }
       db_->commitWriteBatch(batch);
@@ -773,16 +811,14 @@ void PbftManager::secondFinish_() {
   auto end_time_for_step = (step_ + 1) * LAMBDA_ms + STEP_4_DELAY - POLLING_INTERVAL_ms;
 
   if (!soft_voted_block_for_this_round_.second) {
-    auto soft_votes = getVotesOfTypeFromVotesForRoundAndStep_(soft_vote_type, votes_, round, 2,
-                                                              std::make_pair(NULL_BLOCK_HASH, false));
-    auto soft_voted_block_hash = blockWithEnoughVotes_(soft_votes);
+    auto soft_voted_block_hash = blockWithEnoughVotes_(soft_vote_type, round, 2);
 
     auto batch = db_->createWriteBatch();
     db_->addPbftMgrVotedValueToBatch(PbftMgrVotedValue::soft_voted_block_hash_in_round, soft_voted_block_hash.first,
                                      batch);
     db_->addPbftMgrStatusToBatch(PbftMgrStatus::soft_voted_block_in_round, soft_voted_block_hash.second, batch);
     if (soft_voted_block_hash.second && soft_voted_block_hash.first != NULL_BLOCK_HASH) {
-      db_->addSoftVotesToBatch(round, soft_votes, batch);
+      db_->addSoftVotesToBatch(round, vote_mgr_->getVerifiedVotesOfType(soft_vote_type, round, 2), batch);
     }
     db_->commitWriteBatch(batch);
 
@@ -840,114 +876,48 @@ void PbftManager::secondFinish_() {
 
 // There is a quorum of next-votes and set determine that round p should be the current round...
 uint64_t PbftManager::roundDeterminedFromVotes_() {
-  // <<vote_round, vote_step>, count>, <round, step> store in reverse order
-  std::map<std::pair<uint64_t, size_t>, size_t, std::greater<std::pair<uint64_t, size_t>>>
-      next_votes_tally_by_round_step;
   auto round = getPbftRound();
-
-  for (auto const &v : votes_) {
-    if (v.getType() != next_vote_type) {
-      continue;
-    }
-    std::pair<uint64_t, size_t> round_step = std::make_pair(v.getRound(), v.getStep());
-    if (round_step.first >= round) {
-      if (next_votes_tally_by_round_step.find(round_step) != next_votes_tally_by_round_step.end()) {
-        next_votes_tally_by_round_step[round_step] += 1;
-      } else {
-        next_votes_tally_by_round_step[round_step] = 1;
-      }
-    }
+  auto round_step = vote_mgr_->highestRoundStepWithEnoughVotes(next_vote_type, round, TWO_T_PLUS_ONE);
+  if (!round_step) {
+    return round;
   }
-
-  for (auto const &rs_votes : next_votes_tally_by_round_step) {
-    if (rs_votes.second >= TWO_T_PLUS_ONE) {
-      std::vector<Vote> next_votes_for_round_step = getVotesOfTypeFromVotesForRoundAndStep_(
-          next_vote_type, votes_, rs_votes.first.first, rs_votes.first.second, std::make_pair(NULL_BLOCK_HASH, false));
-      if (blockWithEnoughVotes_(next_votes_for_round_step).second) {
-        LOG(log_dg_) << "Found sufficient next votes in round " << rs_votes.first.first << ", step "
-                     << rs_votes.first.second << ", PBFT 2t+1 " << TWO_T_PLUS_ONE;
-        // Update next votes
-        previous_round_next_votes_->update(next_votes_for_round_step, TWO_T_PLUS_ONE);
-        auto next_votes = previous_round_next_votes_->getNextVotes();
-
-        auto batch = db_->createWriteBatch();
-        db_->addPbft2TPlus1ToBatch(rs_votes.first.first, TWO_T_PLUS_ONE, batch);
-        db_->addNextVotesToBatch(rs_votes.first.first, next_votes, batch);
-        if (round > 1) {
-          db_->removeNextVotesToBatch(round - 1, batch);
-        }
-        db_->commitWriteBatch(batch);
-
-        return rs_votes.first.first + 1;
-      }
-    }
+  auto [next_votes_round, next_votes_step] = *round_step;
+  LOG(log_dg_) << "Found sufficient next votes in round " << next_votes_round << ", step " << next_votes_step
+               << ", PBFT 2t+1 " << TWO_T_PLUS_ONE;
+  if (next_votes_round == round) {
+    metrics_.onQuorum(next_vote_type, round, elapsedTimeInRoundMs_());
   }
+  // Update next votes
+  previous_round_next_votes_->update(
+      vote_mgr_->getVerifiedVotesOfType(next_vote_type, next_votes_round, next_votes_step), TWO_T_PLUS_ONE);
+  auto next_votes = previous_round_next_votes_->getNextVotes();
 
-  return round;
-}
-
-// Assumption is that all votes are in the same round, step and of same type...
-std::pair<blk_hash_t, bool> PbftManager::blockWithEnoughVotes_(std::vector<Vote> const &votes) const {
-  if (votes.empty()) {
-    return std::make_pair(NULL_BLOCK_HASH, false);
+  auto batch = db_->createWriteBatch();
+  db_->addPbft2TPlus1ToBatch(next_votes_round, TWO_T_PLUS_ONE, batch);
+  // Next votes replace the ones saved for the round before
+  db_->removeNextVotesToBatch(next_votes_round, batch);
+  db_->addNextVotesToBatch(next_votes_round, next_votes, batch);
+  if (round > 1) {
+    db_->removeNextVotesToBatch(round - 1, batch);
   }
+  db_->commitWriteBatch(batch);
 
-  // <block_hash, count>, store in reverse order
-  std::map<blk_hash_t, size_t, std::greater<blk_hash_t>> tally_by_blockhash;
-  auto vote_type = votes[0].getType();
-  auto vote_round = votes[0].getRound();
-  auto vote_step = votes[0].getStep();
-
-  for (Vote const &v : votes) {
-    if (v.getType() != vote_type) {
-      LOG(log_er_) << "Vote has a different type with " << vote_type << ". VOTE: " << v;
-      assert(false);
-    } else if (v.getRound() != vote_round) {
-      LOG(log_er_) << "Vote has a different round with " << vote_round << ". VOTE: " << v;
-      assert(false);
-    } else if (v.getStep() != vote_step) {
-      LOG(log_er_) << "Next phase vote has a different step with " << vote_step << ". VOTE: " << v;
-      assert(false);
-    }
-
-    auto blockhash = v.getBlockHash();
-    if (tally_by_blockhash.find(blockhash) != tally_by_blockhash.end()) {
-      tally_by_blockhash[blockhash] += 1;
-    } else {
-      tally_by_blockhash[blockhash] = 1;
-    }
+  return next_votes_round + 1;
+}
 
-    for (auto const &blockhash_count : tally_by_blockhash) {
-      if (blockhash_count.second >= TWO_T_PLUS_ONE) {
-        LOG(log_dg_) << "Find block hash " << blockhash_count.first << " vote type " << vote_type << " in round "
-                     << vote_round << " step " << vote_step << " has " << blockhash_count.second << " votes";
-        return std::make_pair(blockhash_count.first, true);
-      } else {
-        LOG(log_tr_) << "Don't have enough votes. block hash " << blockhash_count.first << " vote type " << vote_type
-                     << " for round " << vote_round << " step " << vote_step << " has " << blockhash_count.second
-                     << " votes"
-                     << " (2TP1 = " << TWO_T_PLUS_ONE << ")";
-      }
-    }
+std::pair<blk_hash_t, bool> PbftManager::blockWithEnoughVotes_(PbftVoteTypes vote_type, uint64_t round,
+                                                               size_t step) {
+  if (auto blockhash = vote_mgr_->blockWithEnoughVotes(vote_type, round, step, TWO_T_PLUS_ONE)) {
+    metrics_.onQuorum(vote_type, round, elapsedTimeInRoundMs_());
+    LOG(log_dg_) << "Find block hash " << *blockhash << " vote type " << vote_type << " in round " << round
+                 << " step " << step << " has enough votes";
+    return std::make_pair(*blockhash, true);
   }
-
+  LOG(log_tr_) << "Don't have enough votes. vote type " << vote_type << " for round " << round << " step " << step
+               << " (2TP1 = " << TWO_T_PLUS_ONE << ")";
   return std::make_pair(NULL_BLOCK_HASH, false);
 }
 
-std::vector<Vote> PbftManager::getVotesOfTypeFromVotesForRoundAndStep_(PbftVoteTypes vote_type,
-                                                                       std::vector<Vote> &votes, uint64_t round,
-                                                                       size_t step,
-                                                                       std::pair<blk_hash_t, bool> blockhash) {
-  std::vector<Vote> votes_of_requested_type;
-  std::copy_if(votes.begin(), votes.end(), std::back_inserter(votes_of_requested_type),
-               [vote_type, round, step, blockhash](Vote const &v) {
-                 return (v.getType() == vote_type && v.getRound() == round && v.getStep() == step &&
-                         (blockhash.second == false || blockhash.first == v.getBlockHash()));
-               });
-
-  return votes_of_requested_type;
-}
-
 Vote PbftManager::generateVote(blk_hash_t const &blockhash, PbftVoteTypes type, uint64_t round, size_t step,
                                size_t weighted_index) {
   // sortition proof
@@ -1101,20 +1071,18 @@ std::vector<std::vector<uint>> PbftManager::createMockTrxSchedule(
   return blocks_trx_modes;
 }
 
-std::pair<blk_hash_t, bool> PbftManager::identifyLeaderBlock_(std::vector<Vote> const &votes) {
+std::pair<blk_hash_t, bool> PbftManager::identifyLeaderBlock_() {
   auto round = getPbftRound();
   LOG(log_dg_) << "Into identify leader block, in round " << round;
   // each leader candidate with <vote_signature_hash, pbft_block_hash>
   std::vector<std::pair<vrf_output_t, blk_hash_t>> leader_candidates;
-  for (auto const &v : votes) {
-    if (v.getRound() == round && v.getType() == propose_vote_type) {
-      // We should not pick any null block as leader (proposed when
-      // no new blocks found, or maliciously) if others have blocks.
-      auto proposed_block_hash = v.getBlockHash();
-      if (round == 1 ||
-          (proposed_block_hash != NULL_BLOCK_HASH && !pbft_chain_->findPbftBlockInChain(proposed_block_hash))) {
-        leader_candidates.emplace_back(std::make_pair(v.getCredential(), proposed_block_hash));
-      }
+  for (auto const &v : vote_mgr_->getVerifiedVotesOfType(propose_vote_type, round)) {
+    // We should not pick any null block as leader (proposed when
+    // no new blocks found, or maliciously) if others have blocks.
+    auto proposed_block_hash = v.getBlockHash();
+    if (round == 1 ||
+        (proposed_block_hash != NULL_BLOCK_HASH && !pbft_chain_->findPbftBlockInChain(proposed_block_hash))) {
+      leader_candidates.emplace_back(std::make_pair(v.getCredential(), proposed_block_hash));
     }
   }
   if (leader_candidates.empty()) {
@@ -1269,20 +1237,46 @@ bool PbftManager::pushCertVotedPbftBlockIntoChain_(taraxa::blk_hash_t const &cer
     LOG(log_er_) << "Failed push PBFT block " << pbft_block->getBlockHash() << " into chain";
     return false;
   }
+  metrics_.onFinalized(getPbftRound(), pbft_block->getTimestamp());
   // cleanup PBFT unverified blocks table
   pbft_chain_->cleanupUnverifiedPbftBlocks(*pbft_block);
   return true;
 }
 
 void PbftManager::pushSyncedPbftBlocksIntoChain_() {
+  // Consecutive synced blocks are written in a single batch and executed as a range of periods. Batched blocks stay in
+  // the synced queue until the batch is committed, so that network keeps seeing them as the synced head
+  auto batch = db_->createWriteBatch();
+  std::vector<std::shared_ptr<PbftBlock>> batched_blocks;
+  uint64_t last_batched_cert_votes_round = 0;
+  auto commit_batch = [&] {
+    if (batched_blocks.empty()) {
+      return;
+    }
+    commitPbftBlocks_(batch, batched_blocks);
+    metrics_.onSynced(last_batched_cert_votes_round);
+    for (size_t i = 0; i < batched_blocks.size(); ++i) {
+      pbft_chain_->pbftSyncedQueuePopFront();
+    }
+    batch = db_->createWriteBatch();
+    batched_blocks.clear();
+    vote_mgr_->removeVerifiedVotes();
+    update_dpos_state_();
+    // update sortition_threshold and TWO_T_PLUS_ONE
+    updateTwoTPlusOneAndThreshold_();
+    db_->savePbftMgrStatus(PbftMgrStatus::executed_block, false);
+    executed_pbft_block_ = false;
+  };
+
   size_t pbft_synced_queue_size;
-  while (!pbft_chain_->pbftSyncedQueueEmpty()) {
-    PbftBlockCert pbft_block_and_votes = pbft_chain_->pbftSyncedQueueFront();
+  while (pbft_chain_->pbftSyncedQueueSize() > batched_blocks.size()) {
+    PbftBlockCert pbft_block_and_votes = pbft_chain_->pbftSyncedQueueAt(batched_blocks.size());
     auto round = getPbftRound();
     LOG(log_dg_) << "Pick pbft block " << pbft_block_and_votes.pbft_blk->getBlockHash()
                  << " from synced queue in round " << round;
     if (pbft_chain_->findPbftBlockInChain(pbft_block_and_votes.pbft_blk->getBlockHash())) {
       // pushed already from PBFT unverified queue, remove and skip it
+      commit_batch();
       pbft_chain_->pbftSyncedQueuePopFront();
 
       pbft_synced_queue_size = pbft_chain_->pbftSyncedQueueSize();
@@ -1303,51 +1297,66 @@ void PbftManager::pushSyncedPbftBlocksIntoChain_() {
       LOG(log_er_) << "Synced PBFT block " << pbft_block_and_votes.pbft_blk->getBlockHash()
                    << " doesn't have enough valid cert votes. Clear synced PBFT blocks!"
                    << " DPOS total votes count: " << getDposTotalVotesCount();
+      commit_batch();
       pbft_chain_->clearSyncedPbftBlocks();
       break;
     }
-    if (!pbft_chain_->checkPbftBlockValidation(*pbft_block_and_votes.pbft_blk)) {
+    // Batched blocks are not in the chain yet, so the block has to follow the last of them
+    auto const &pbft_block = *pbft_block_and_votes.pbft_blk;
+    auto const follows_chain = batched_blocks.empty()
+                                   ? pbft_chain_->checkPbftBlockValidation(pbft_block)
+                                   : pbft_block.getPrevBlockHash() == batched_blocks.back()->getBlockHash();
+    if (!follows_chain) {
       // PBFT chain syncing faster than DAG syncing, wait!
-      pbft_synced_queue_size = pbft_chain_->pbftSyncedQueueSize();
+      pbft_synced_queue_size = pbft_chain_->pbftSyncedQueueSize() - batched_blocks.size();
       if (pbft_last_observed_synced_queue_size_ != pbft_synced_queue_size) {
-        LOG(log_dg_) << "PBFT chain unable to push synced block " << pbft_block_and_votes.pbft_blk->getBlockHash();
+        LOG(log_dg_) << "PBFT chain unable to push synced block " << pbft_block.getBlockHash();
         LOG(log_dg_) << "PBFT synced queue still contains " << pbft_synced_queue_size
                      << " synced blocks that could not be pushed.";
       }
       pbft_last_observed_synced_queue_size_ = pbft_synced_queue_size;
       break;
     }
-    if (!comparePbftBlockScheduleWithDAGblocks_(*pbft_block_and_votes.pbft_blk)) {
+    if (!comparePbftBlockScheduleWithDAGblocks_(pbft_block)) {
       break;
     }
-    if (pushPbftBlock_(pbft_block_and_votes)) {
-      LOG(log_nf_) << node_addr_ << " push synced PBFT block " << pbft_block_and_votes.pbft_blk->getBlockHash()
-                   << " in round " << round;
+    if (addPbftBlockToBatch_(pbft_block_and_votes, batch)) {
+      LOG(log_nf_) << node_addr_ << " push synced PBFT block " << pbft_block.getBlockHash() << " in round " << round;
     } else {
-      LOG(log_er_) << "Failed push PBFT block " << pbft_block_and_votes.pbft_blk->getBlockHash() << " into chain";
+      LOG(log_er_) << "Failed push PBFT block " << pbft_block.getBlockHash() << " into chain";
       break;
     }
 
-    // Remove from PBFT synced queue
-    pbft_chain_->pbftSyncedQueuePopFront();
-    if (executed_pbft_block_) {
-      vote_mgr_->removeVerifiedVotes();
-      update_dpos_state_();
-      // update sortition_threshold and TWO_T_PLUS_ONE
+    batched_blocks.push_back(pbft_block_and_votes.pbft_blk);
+    last_batched_cert_votes_round = pbft_block_and_votes.cert_votes.front().getRound();
+    // Cert votes of the next block are validated with DPOS state after this one. It is not available while the
+    // executor is more than DPOS delay behind, then the batch has to be executed first
+    if (batched_blocks.size() >= c_max_synced_blocks_batch_size ||
+        !tryUpdateDposState_(pbft_chain_->getPbftChainSize() + batched_blocks.size())) {
+      commit_batch();
+    } else {
       updateTwoTPlusOneAndThreshold_();
-      db_->savePbftMgrStatus(PbftMgrStatus::executed_block, false);
-      executed_pbft_block_ = false;
     }
-    pbft_synced_queue_size = pbft_chain_->pbftSyncedQueueSize();
+    pbft_synced_queue_size = pbft_chain_->pbftSyncedQueueSize() - batched_blocks.size();
     if (pbft_last_observed_synced_queue_size_ != pbft_synced_queue_size) {
       LOG(log_dg_) << "PBFT synced queue still contains " << pbft_synced_queue_size
                    << " synced blocks that could not be pushed.";
     }
     pbft_last_observed_synced_queue_size_ = pbft_synced_queue_size;
   }
+  commit_batch();
 }
 
 bool PbftManager::pushPbftBlock_(PbftBlockCert const &pbft_block_cert_votes) {
+  auto batch = db_->createWriteBatch();
+  if (!addPbftBlockToBatch_(pbft_block_cert_votes, batch)) {
+    return false;
+  }
+  commitPbftBlocks_(batch, {pbft_block_cert_votes.pbft_blk});
+  return true;
+}
+
+bool PbftManager::addPbftBlockToBatch_(PbftBlockCert const &pbft_block_cert_votes, DbStorage::BatchPtr const &batch) {
   auto const &pbft_block_hash = pbft_block_cert_votes.pbft_blk->getBlockHash();
   if (db_->pbftBlockInDb(pbft_block_hash)) {
     LOG(log_er_) << "PBFT block: " << pbft_block_hash << " in DB already.";
@@ -1358,7 +1367,6 @@ bool PbftManager::pushPbftBlock_(PbftBlockCert const &pbft_block_cert_votes) {
   auto const &cert_votes = pbft_block_cert_votes.cert_votes;
   auto pbft_period = pbft_block->getPeriod();
 
-  auto batch = db_->createWriteBatch();
   // Add cert votes in DB
   db_->addCertVotesToBatch(pbft_block_hash, cert_votes, batch);
   LOG(log_nf_) << "Storing cert votes of pbft blk " << pbft_block_hash;
@@ -1367,10 +1375,6 @@ bool PbftManager::pushPbftBlock_(PbftBlockCert const &pbft_block_cert_votes) {
   db_->addPbftBlockPeriodToBatch(pbft_period, pbft_block_hash, batch);
   // Add PBFT block in DB
   db_->addPbftBlockToBatch(*pbft_block, batch);
-  // update PBFT chain size
-  pbft_chain_->updatePbftChain(pbft_block_hash);
-  // Update PBFT chain head block
-  db_->addPbftHeadToBatch(pbft_chain_->getHeadHash(), pbft_chain_->getJsonStr(), batch);
 
   // Set DAG blocks period
   auto const &anchor_hash = pbft_block->getPivotDagBlockHash();
@@ -1381,20 +1385,38 @@ bool PbftManager::pushPbftBlock_(PbftBlockCert const &pbft_block_cert_votes) {
   for (auto const &blk_hash : finalized_dag_blk_hashes) {
     db_->addDagBlockPeriodToBatch(blk_hash, pbft_period, batch);
   }
+  return true;
+}
 
+void PbftManager::commitPbftBlocks_(DbStorage::BatchPtr const &batch,
+                                    std::vector<std::shared_ptr<PbftBlock>> const &pbft_blocks) {
+  auto const &last_pbft_block = pbft_blocks.back();
+  // Update PBFT chain head
+  db_->addPbftHeadToBatch(pbft_chain_->getHeadHash(),
+                          pbft_chain_->getJsonStr(pbft_chain_->getPbftChainSize() + pbft_blocks.size(),
+                                                  last_pbft_block->getBlockHash()),
+                          batch);
+  db_->addPbftMgrStatusToBatch(PbftMgrStatus::executed_block, true, batch);
   // Commit DB
   db_->commitWriteBatch(batch);
+  // update PBFT chain size
+  for (auto const &pbft_block : pbft_blocks) {
+    pbft_chain_->updatePbftChain(pbft_block->getBlockHash());
+  }
 
-  LOG(log_nf_) << node_addr_ << " successful push unexecuted PBFT block " << pbft_block_hash << " in period "
-               << pbft_period << " into chain! In round " << getPbftRound();
+  auto pbft_period = last_pbft_block->getPeriod();
+  LOG(log_nf_) << node_addr_ << " successful push unexecuted PBFT block " << last_pbft_block->getBlockHash()
+               << " in period " << pbft_period << " into chain! In round " << getPbftRound();
 
-  executor_->execute(pbft_block);
+  // Periods finalized before this one that are not executed yet
+  auto const last_executed_period = final_chain_->last_block_number();
+  metrics_.onExecutorLag(pbft_period > last_executed_period ? pbft_period - last_executed_period - 1 : 0);
+  // Executor loads the periods before the last one from DB
+  executor_->execute(last_pbft_block);
 
   // Reset proposed PBFT block hash to False for next pbft block proposal
   proposed_block_hash_ = std::make_pair(NULL_BLOCK_HASH, false);
-  db_->savePbftMgrStatus(PbftMgrStatus::executed_block, true);
   executed_pbft_block_ = true;
-  return true;
 }
 
 void PbftManager::updateTwoTPlusOneAndThreshold_() {
@@ -1453,6 +1475,12 @@ void PbftManager::countVotes_() {
   }
 }
 
+uint64_t PbftManager::elapsedTimeInRoundMs_() const {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() -
+                                                               round_clock_initial_datetime_)
+      .count();
+}
+
 bool PbftManager::is_syncing_() {
   if (auto net = network_.lock()) {
     return net->pbft_syncing();
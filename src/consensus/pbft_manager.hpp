@@ -11,18 +11,18 @@
 #include "network/taraxa_capability.hpp"
 #include "node/executor.hpp"
 #include "pbft_chain.hpp"
+#include "pbft_metrics.hpp"
 #include "vote.hpp"
 #include "vrf_wrapper.hpp"
 
 #define NULL_BLOCK_HASH blk_hash_t(0)
-#define POLLING_INTERVAL_ms 100  // milliseconds...
+#define POLLING_INTERVAL_ms 100  // milliseconds, max wait between checks in steps waiting for votes
+#define MIN_WAKE_UP_INTERVAL_ms 20  // milliseconds, min wait between checks woken up by events in other steps
 #define MAX_STEPS 13
 
 namespace taraxa {
 class FullNode;
 
-enum PbftStates { value_proposal_state = 1, filter_state, certify_state, finish_state, finish_polling_state };
-
 enum PbftSyncRequestReason {
   missing_dag_blk = 1,
   invalid_cert_voted_block,
@@ -46,6 +46,8 @@ class PbftManager {
   void start();
   void stop();
   void run();
+  // Wakes up PBFT loop to check new votes or blocks before the step timer fires
+  void wakeUp();
 
   bool shouldSpeak(PbftVoteTypes type, uint64_t round, size_t step, size_t weighted_index);
 
@@ -69,15 +71,21 @@ class PbftManager {
       std::shared_ptr<std::vector<std::pair<blk_hash_t, std::vector<bool>>>> trx_overlap_table);
   size_t getPbftCommitteeSize() const { return COMMITTEE_SIZE; }
   u_long getPbftInitialLambda() const { return LAMBDA_ms_MIN; }
+  PbftMetrics const &getMetrics() const { return metrics_; }
 
  private:
   // DPOS
   void update_dpos_state_();
+  // Single attempt of update_dpos_state_ for the chain of pbft_chain_size blocks, false if DPOS state of the period is
+  // not executed yet
+  bool tryUpdateDposState_(uint64_t pbft_chain_size);
   size_t dpos_eligible_vote_count_(addr_t const &addr);
 
   void resetStep_();
   bool resetRound_();
-  void sleep_();
+  // Returns false if woken up by an event before the step timer fired. Events during the first min_sleep_ms don't
+  // wake it up before min_sleep_ms passes
+  bool sleep_(u_long min_sleep_ms = 0);
 
   void initialState_();
   void setNextState_();
@@ -97,17 +105,13 @@ class PbftManager {
 
   uint64_t roundDeterminedFromVotes_();
 
-  std::pair<blk_hash_t, bool> blockWithEnoughVotes_(std::vector<Vote> const &votes) const;
-
-  std::vector<Vote> getVotesOfTypeFromVotesForRoundAndStep_(PbftVoteTypes vote_type, std::vector<Vote> &votes,
-                                                            uint64_t round, size_t step,
-                                                            std::pair<blk_hash_t, bool> blockhash);
+  std::pair<blk_hash_t, bool> blockWithEnoughVotes_(PbftVoteTypes vote_type, uint64_t round, size_t step);
 
   size_t placeVote_(blk_hash_t const &blockhash, PbftVoteTypes vote_type, uint64_t round, size_t step);
 
   std::pair<blk_hash_t, bool> proposeMyPbftBlock_();
 
-  std::pair<blk_hash_t, bool> identifyLeaderBlock_(std::vector<Vote> const &votes);
+  std::pair<blk_hash_t, bool> identifyLeaderBlock_();
 
   bool checkPbftBlockValid_(blk_hash_t const &block_hash) const;
 
@@ -126,9 +130,16 @@ class PbftManager {
   void pushSyncedPbftBlocksIntoChain_();
 
   bool pushPbftBlock_(PbftBlockCert const &pbft_block_cert_votes);
+  // Adds the block and its DAG order to the batch. DAG order is set in memory as well, so that the order of the next
+  // block can be computed, PBFT chain is updated by commitPbftBlocks_
+  bool addPbftBlockToBatch_(PbftBlockCert const &pbft_block_cert_votes, DbStorage::BatchPtr const &batch);
+  // Commits the batch of consecutive blocks with the new chain head, then updates in-memory chain and executes
+  // finalized periods up to the last block
+  void commitPbftBlocks_(DbStorage::BatchPtr const &batch, std::vector<std::shared_ptr<PbftBlock>> const &pbft_blocks);
 
   void updateTwoTPlusOneAndThreshold_();
   bool is_syncing_();
+  uint64_t elapsedTimeInRoundMs_() const;
 
   std::atomic<bool> stopped_ = true;
   // Using to check if PBFT block has been proposed already in one period
@@ -166,8 +177,6 @@ class PbftManager {
   std::unordered_map<size_t, blk_hash_t> cert_voted_values_for_round_;
   std::pair<blk_hash_t, bool> soft_voted_block_for_this_round_ = std::make_pair(NULL_BLOCK_HASH, false);
 
-  std::vector<Vote> votes_;
-
   time_point round_clock_initial_datetime_;
   time_point now_;
   std::chrono::duration<double> duration_;
@@ -191,6 +200,8 @@ class PbftManager {
   size_t pbft_step_last_broadcast_ = 0;
 
   size_t pbft_last_observed_synced_queue_size_ = 0;
+  // Synced PBFT blocks committed in one batch at most
+  static constexpr size_t c_max_synced_blocks_batch_size = 100;
 
   std::atomic<uint64_t> dpos_period_;
   std::atomic<size_t> dpos_votes_count_;
@@ -202,8 +213,12 @@ class PbftManager {
 
   std::string dag_genesis_;
 
+  PbftMetrics metrics_;
+
   std::condition_variable stop_cv_;
   std::mutex stop_mtx_;
+  // Guarded by stop_mtx_
+  bool wake_up_ = false;
 
   // TODO: will remove later, TEST CODE
   void countVotes_();
@@ -0,0 +1,89 @@
+#include "pbft_metrics.hpp"
+
+#include <libdevcore/Common.h>
+
+namespace taraxa {
+
+namespace {
+
+Json::Value toJson(util::Histogram const &histogram) {
+  auto const snapshot = histogram.snapshot();
+  Json::Value ret(Json::objectValue);
+  ret["count"] = Json::UInt64(snapshot.count);
+  ret["sum"] = Json::UInt64(snapshot.sum);
+  ret["max"] = Json::UInt64(snapshot.max);
+  // Cumulative counts of values up to the bound, prometheus style
+  auto &buckets = ret["buckets"] = Json::Value(Json::arrayValue);
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < snapshot.buckets.size(); ++i) {
+    cumulative += snapshot.buckets[i];
+    Json::Value bucket(Json::objectValue);
+    bucket["le"] = i < util::Histogram::c_bounds.size() ? Json::Value(Json::UInt64(util::Histogram::c_bounds[i]))
+                                                         : Json::Value("+Inf");
+    bucket["count"] = Json::UInt64(cumulative);
+    buckets.append(bucket);
+  }
+  return ret;
+}
+
+}  // namespace
+
+void PbftMetrics::onStep(PbftStates state, uint64_t round, size_t step) {
+  if (current_step_ && current_step_->state == state && current_step_->round == round && current_step_->step == step) {
+    return;
+  }
+  if (current_step_) {
+    time_in_state_[current_step_->state].observe(msSince(current_step_->began));
+  }
+  current_step_ = Step{state, round, step, Clock::now()};
+}
+
+void PbftMetrics::onQuorum(PbftVoteTypes type, uint64_t round, uint64_t elapsed_in_round_ms) {
+  if (last_quorum_round_[type] >= round) {
+    return;
+  }
+  last_quorum_round_[type] = round;
+  time_to_quorum_[type].observe(elapsed_in_round_ms);
+}
+
+void PbftMetrics::onFinalized(uint64_t round, uint64_t pbft_block_timestamp) {
+  if (last_finalized_round_ && *last_finalized_round_ < round) {
+    rounds_per_period_.observe(round - *last_finalized_round_);
+  }
+  last_finalized_round_ = round;
+  auto const now_ms = dev::utcTime() * 1000;
+  auto const proposed_ms = pbft_block_timestamp * 1000;
+  proposal_to_finalization_.observe(now_ms > proposed_ms ? now_ms - proposed_ms : 0);
+}
+
+void PbftMetrics::onSynced(uint64_t cert_votes_round) {
+  if (!last_finalized_round_ || *last_finalized_round_ < cert_votes_round) {
+    last_finalized_round_ = cert_votes_round;
+  }
+}
+
+void PbftMetrics::onExecutorLag(uint64_t unexecuted_periods) { executor_lag_.observe(unexecuted_periods); }
+
+Json::Value PbftMetrics::getJson() const {
+  Json::Value ret(Json::objectValue);
+  auto &time_in_state = ret["time_in_state_ms"] = Json::Value(Json::objectValue);
+  time_in_state["value_proposal"] = toJson(time_in_state_[value_proposal_state]);
+  time_in_state["filter"] = toJson(time_in_state_[filter_state]);
+  time_in_state["certify"] = toJson(time_in_state_[certify_state]);
+  time_in_state["finish"] = toJson(time_in_state_[finish_state]);
+  time_in_state["finish_polling"] = toJson(time_in_state_[finish_polling_state]);
+  auto &time_to_quorum = ret["time_to_2t_plus_1_ms"] = Json::Value(Json::objectValue);
+  time_to_quorum["soft"] = toJson(time_to_quorum_[soft_vote_type]);
+  time_to_quorum["cert"] = toJson(time_to_quorum_[cert_vote_type]);
+  time_to_quorum["next"] = toJson(time_to_quorum_[next_vote_type]);
+  ret["rounds_per_period"] = toJson(rounds_per_period_);
+  ret["proposal_to_finalization_ms"] = toJson(proposal_to_finalization_);
+  ret["executor_lag_periods"] = toJson(executor_lag_);
+  return ret;
+}
+
+uint64_t PbftMetrics::msSince(Clock::time_point since) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - since).count();
+}
+
+}  // namespace taraxa
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <json/json.h>
+
+#include <array>
+#include <chrono>
+#include <optional>
+
+#include "consensus/pbft_chain.hpp"
+#include "util/histogram.hpp"
+
+namespace taraxa {
+
+/**
+ * Consensus latency metrics of PBFT manager, all durations are in milliseconds:
+ * - time spent in each PBFT step, by its state
+ * - time from round start until 2t+1 votes of a type are seen for a block
+ * - rounds it took to finalize a period
+ * - latency from proposal of a PBFT block (by its timestamp, second precision) to its finalization
+ * - number of finalized periods not yet executed when a new period is finalized
+ *
+ * Recorded by PBFT thread, read by RPC.
+ */
+class PbftMetrics {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  // Called on every PBFT loop iteration, time of the previous step is recorded when the step changes
+  void onStep(PbftStates state, uint64_t round, size_t step);
+  // Only the first quorum of each vote type in a round is recorded
+  void onQuorum(PbftVoteTypes type, uint64_t round, uint64_t elapsed_in_round_ms);
+  void onFinalized(uint64_t round, uint64_t pbft_block_timestamp);
+  // Synced periods were finalized by other nodes in the round of their cert votes, rounds of the next period finalized
+  // by this node are counted from it instead of from the last period it finalized
+  void onSynced(uint64_t cert_votes_round);
+  void onExecutorLag(uint64_t unexecuted_periods);
+
+  Json::Value getJson() const;
+
+ private:
+  struct Step {
+    PbftStates state;
+    uint64_t round;
+    size_t step;
+    Clock::time_point began;
+  };
+
+  static uint64_t msSince(Clock::time_point since);
+
+  // Owned by PBFT thread
+  std::optional<Step> current_step_;
+  std::array<uint64_t, next_vote_type + 1> last_quorum_round_ = {};
+  std::optional<uint64_t> last_finalized_round_;
+
+  std::array<util::Histogram, finish_polling_state + 1> time_in_state_;
+  std::array<util::Histogram, next_vote_type + 1> time_to_quorum_;
+  util::Histogram rounds_per_period_;
+  util::Histogram proposal_to_finalization_;
+  util::Histogram executor_lag_;
+};
+
+}  // namespace taraxa
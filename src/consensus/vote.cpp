@@ -4,11 +4,14 @@
 #include <libdevcrypto/Common.h>
 #include <libethcore/Common.h>
 
+#include <algorithm>
+#include <tuple>
+
 #include "consensus/pbft_manager.hpp"
 
 namespace taraxa {
 
-VrfPbftSortition::VrfPbftSortition(bytes const& b) {
+VrfPbftSortition::VrfPbftSortition(bytes const& b, bool verify_proof) {
   dev::RLP const rlp(b);
   if (!rlp.isList()) {
     throw std::invalid_argument("VrfPbftSortition RLP must be a list");
@@ -21,7 +24,19 @@ VrfPbftSortition::VrfPbftSortition(bytes const& b) {
   pbft_msg.weighted_index = rlp[4].toInt<size_t>();
   proof = rlp[5].toHash<vrf_proof_t>();
 
-  verify();
+  if (verify_proof) {
+    verify();
+  }
+}
+
+VrfPbftSortition::VrfPbftSortition(vrf_pk_t const& pk, VrfPbftMsg const& pbft_msg, vrf_proof_t const& proof,
+                                   bool verify_proof)
+    : pbft_msg(pbft_msg) {
+  this->pk = pk;
+  this->proof = proof;
+  if (verify_proof) {
+    verify();
+  }
 }
 
 bytes VrfPbftSortition::getRlpBytes() const {
@@ -42,24 +57,41 @@ bytes VrfPbftSortition::getRlpBytes() const {
  * Sortition return true:
  * CREDENTIAL(VRF output) / MAX_HASH(max512bits) <= SORTITION THRESHOLD / DPOS TOTAL VOTES COUNT
  * i.e., CREDENTIAL * DPOS TOTAL VOTES COUNT <= SORTITION THRESHOLD * MAX_HASH
+ * i.e., CREDENTIAL <= floor(SORTITION THRESHOLD * MAX_HASH / DPOS TOTAL VOTES COUNT)
  * otherwise return false
  */
 bool VrfPbftSortition::canSpeak(size_t threshold, size_t dpos_total_votes_count) const {
-  uint1024_t left = (uint1024_t)((uint512_t)output) * dpos_total_votes_count;
-  uint1024_t right = (uint1024_t)max512bits * threshold;
-  return left <= right;
+  // Threshold and DPOS total votes count change once per period, so the bound is computed once per thread
+  thread_local std::tuple<size_t, size_t, uint512_t> bound{0, 0, speakBound(0, 0)};
+  if (std::get<0>(bound) != threshold || std::get<1>(bound) != dpos_total_votes_count) {
+    bound = {threshold, dpos_total_votes_count, speakBound(threshold, dpos_total_votes_count)};
+  }
+  return (uint512_t)output <= std::get<2>(bound);
+}
+
+uint512_t VrfPbftSortition::speakBound(size_t threshold, size_t dpos_total_votes_count) {
+  if (!dpos_total_votes_count) {
+    return max512bits;
+  }
+  uint1024_t bound = (uint1024_t)max512bits * threshold / dpos_total_votes_count;
+  return bound > (uint1024_t)max512bits ? max512bits : (uint512_t)bound;
 }
 
-Vote::Vote(dev::RLP const& rlp) {
+Vote::Vote(dev::RLP const& rlp, bool verify_vrf) {
   if (!rlp.isList()) throw std::invalid_argument("vote RLP must be a list");
   blockhash_ = rlp[0].toHash<blk_hash_t>();
-  vrf_sortition_ = VrfPbftSortition(rlp[1].toBytes());
+  vrf_sortition_ = VrfPbftSortition(rlp[1].toBytes(), verify_vrf);
   vote_signature_ = rlp[2].toHash<sig_t>();
   vote_hash_ = sha3(true);
 }
 
 Vote::Vote(bytes const& b) : Vote(dev::RLP(b)) {}
 
+Vote::Vote(blk_hash_t const& blockhash, VrfPbftSortition const& vrf_sortition, sig_t const& vote_signature)
+    : blockhash_(blockhash), vote_signature_(vote_signature), vrf_sortition_(vrf_sortition) {
+  vote_hash_ = sha3(true);
+}
+
 Vote::Vote(secret_t const& node_sk, VrfPbftSortition const& vrf_sortition, blk_hash_t const& blockhash)
     : blockhash_(blockhash), vrf_sortition_(vrf_sortition) {
   vote_signature_ = dev::sign(node_sk, sha3(false));
@@ -79,6 +111,148 @@ bytes Vote::rlp(bool inc_sig) const {
   return s.out();
 }
 
+constexpr uint8_t c_compact_cert_votes_version = 1;
+
+bytes encodeCertVotes(blk_hash_t const& pbft_block_hash, std::vector<Vote> const& cert_votes) {
+  auto const compact = !cert_votes.empty() && std::all_of(cert_votes.begin(), cert_votes.end(), [&](auto const& v) {
+    return v.getBlockHash() == pbft_block_hash && v.getRound() == cert_votes[0].getRound() &&
+           v.getStep() == cert_votes[0].getStep() && v.getType() == cert_votes[0].getType();
+  });
+  dev::RLPStream s;
+  if (!compact) {
+    s.appendList(cert_votes.size());
+    for (auto const& v : cert_votes) {
+      s.appendRaw(v.rlp(true));
+    }
+    return s.out();
+  }
+
+  s.appendList(5);
+  s << c_compact_cert_votes_version;
+  s << cert_votes[0].getRound();
+  s << cert_votes[0].getStep();
+  s << cert_votes[0].getType();
+  s.appendList(cert_votes.size());
+  for (auto const& v : cert_votes) {
+    s.appendList(4);
+    s << v.getVrfSortition().pk;
+    s << v.getWeightedIndex();
+    s << v.getSortitionProof();
+    s << v.getVoteSignature();
+  }
+  return s.out();
+}
+
+std::vector<Vote> decodeCertVotes(blk_hash_t const& pbft_block_hash, dev::RLP const& rlp, bool verify_vrf) {
+  if (!rlp.isList()) {
+    throw std::invalid_argument("Cert votes RLP must be a list");
+  }
+  std::vector<Vote> cert_votes;
+  // Legacy encoding is a list of votes, each of them is a list
+  if (!rlp.itemCount() || rlp[0].isList()) {
+    cert_votes.reserve(rlp.itemCount());
+    for (auto const& v : rlp) {
+      cert_votes.emplace_back(v, verify_vrf);
+    }
+    return cert_votes;
+  }
+
+  if (auto const version = rlp[0].toInt<uint8_t>(); version != c_compact_cert_votes_version) {
+    throw std::invalid_argument("Unknown cert votes version " + std::to_string(version));
+  }
+  auto const round = rlp[1].toInt<uint64_t>();
+  auto const step = rlp[2].toInt<size_t>();
+  auto const type = PbftVoteTypes(rlp[3].toInt<uint>());
+  cert_votes.reserve(rlp[4].itemCount());
+  for (auto const& v : rlp[4]) {
+    VrfPbftSortition vrf_sortition(v[0].toHash<vrf_wrapper::vrf_pk_t>(),
+                                   VrfPbftMsg(type, round, step, v[1].toInt<size_t>()),
+                                   v[2].toHash<vrf_wrapper::vrf_proof_t>(), verify_vrf);
+    cert_votes.emplace_back(pbft_block_hash, vrf_sortition, v[3].toHash<sig_t>());
+  }
+  return cert_votes;
+}
+
+bool VoteIndex::insert(Vote const& vote) {
+  auto& round = rounds_[vote.getRound()];
+  if (!round.hashes.insert(vote.getHash()).second) {
+    return false;
+  }
+  auto& tally = round.tallies[std::make_pair(vote.getStep(), vote.getType())];
+  auto const& blockhash = vote.getBlockHash();
+  auto& block_votes = tally.votes_by_block[blockhash];
+  block_votes.emplace_back(vote);
+  if (block_votes.size() > tally.top_votes) {
+    tally.top_votes = block_votes.size();
+    tally.top_block = blockhash;
+  }
+  ++size_;
+  return true;
+}
+
+void VoteIndex::eraseRoundsBelow(uint64_t round) {
+  for (auto it = rounds_.begin(); it != rounds_.end() && it->first < round;) {
+    size_ -= it->second.hashes.size();
+    it = rounds_.erase(it);
+  }
+}
+
+void VoteIndex::clear() {
+  rounds_.clear();
+  size_ = 0;
+}
+
+std::vector<Vote> VoteIndex::getVotes(PbftVoteTypes type, uint64_t round, std::optional<size_t> step,
+                                      std::optional<blk_hash_t> const& blockhash) const {
+  std::vector<Vote> votes;
+  auto round_it = rounds_.find(round);
+  if (round_it == rounds_.end()) {
+    return votes;
+  }
+  for (auto const& [step_type, tally] : round_it->second.tallies) {
+    if (step_type.second != type || (step && step_type.first != *step)) {
+      continue;
+    }
+    if (blockhash) {
+      if (auto it = tally.votes_by_block.find(*blockhash); it != tally.votes_by_block.end()) {
+        votes.insert(votes.end(), it->second.begin(), it->second.end());
+      }
+      continue;
+    }
+    for (auto const& block_votes : tally.votes_by_block) {
+      votes.insert(votes.end(), block_votes.second.begin(), block_votes.second.end());
+    }
+  }
+  return votes;
+}
+
+std::optional<blk_hash_t> VoteIndex::blockWithEnoughVotes(PbftVoteTypes type, uint64_t round, size_t step,
+                                                          size_t threshold) const {
+  auto round_it = rounds_.find(round);
+  if (round_it == rounds_.end()) {
+    return std::nullopt;
+  }
+  auto it = round_it->second.tallies.find(std::make_pair(step, type));
+  if (it == round_it->second.tallies.end() || it->second.top_votes < threshold) {
+    return std::nullopt;
+  }
+  return it->second.top_block;
+}
+
+std::optional<std::pair<uint64_t, size_t>> VoteIndex::highestRoundStepWithEnoughVotes(PbftVoteTypes type,
+                                                                                      uint64_t from_round,
+                                                                                      size_t threshold) const {
+  for (auto round_it = rounds_.rbegin(); round_it != rounds_.rend() && round_it->first >= from_round; ++round_it) {
+    auto const& tallies = round_it->second.tallies;
+    for (auto it = tallies.rbegin(); it != tallies.rend(); ++it) {
+      if (it->first.second == type && it->second.top_votes >= threshold) {
+        return std::make_pair(round_it->first, it->first.first);
+      }
+    }
+  }
+  return std::nullopt;
+}
+
 VoteManager::VoteManager(addr_t node_addr, std::shared_ptr<DbStorage> db, std::shared_ptr<FinalChain> final_chain,
                          std::shared_ptr<PbftChain> pbft_chain)
     : db_(db), pbft_chain_(pbft_chain), final_chain_(final_chain) {
@@ -99,6 +273,9 @@ VoteManager::VoteManager(addr_t node_addr, std::shared_ptr<DbStorage> db, std::s
       }
       LOG(log_dg_) << "Retrieve unverified vote " << v;
     }
+    for (auto const& v : unverified_votes) {
+      verifyVoteCryptoAsync_(v, true);
+    }
   }
   {
     auto verified_votes = db_->getVerifiedVotes();
@@ -113,6 +290,7 @@ VoteManager::VoteManager(addr_t node_addr, std::shared_ptr<DbStorage> db, std::s
         std::unordered_map<vote_hash_t, Vote> votes{std::make_pair(hash, v)};
         verified_votes_[pbft_round] = votes;
       }
+      verified_votes_index_.insert(v);
       LOG(log_dg_) << "Retrieve verified vote " << v;
     }
   }
@@ -123,7 +301,6 @@ VoteManager::VoteManager(addr_t node_addr, std::shared_ptr<DbStorage> db, std::s
 void VoteManager::addUnverifiedVote(taraxa::Vote const& vote) {
   uint64_t pbft_round = vote.getRound();
   auto hash = vote.getHash();
-  vote.getVoterAddr();  // this will cache object variables - speed up
   {
     upgradableLock_ lock(unverified_votes_access_);
     std::map<uint64_t, std::unordered_map<vote_hash_t, Vote>>::const_iterator found_round =
@@ -142,9 +319,72 @@ void VoteManager::addUnverifiedVote(taraxa::Vote const& vote) {
       unverified_votes_[pbft_round] = votes;
     }
   }
+  verifyVoteCryptoAsync_(vote, true);
   LOG(log_dg_) << "Add unverified vote " << vote;
 }
 
+void VoteManager::verifyVoteCryptoAsync_(Vote const& vote, bool queued) {
+  verification_pool_.post([this, vote, queued] {
+    auto const& hash = vote.getHash();
+    if (crypto_checked_votes_.count(hash)) {
+      return;
+    }
+    auto const valid = verifyVoteCrypto(vote);
+    if (!queued) {
+      crypto_checked_votes_.insert(hash, valid);
+      return;
+    }
+    // Vote might be verified or cleaned up in the meantime, then the result is not needed. Queued copy gets the
+    // recovered voter cached, so that PBFT loop doesn't recover it again
+    uniqueLock_ lock(unverified_votes_access_);
+    if (auto round_it = unverified_votes_.find(vote.getRound()); round_it != unverified_votes_.end()) {
+      if (auto it = round_it->second.find(hash); it != round_it->second.end()) {
+        crypto_checked_votes_.insert(hash, valid);
+        it->second = vote;
+      }
+    }
+  });
+}
+
+void VoteManager::verifyVotesCryptoAsync(std::vector<Vote> const& votes) {
+  for (auto const& v : votes) {
+    verifyVoteCryptoAsync_(v, false);
+  }
+}
+
+bool VoteManager::verifyVoteCryptoCached_(Vote const& vote) const {
+  if (auto [valid, found] = crypto_checked_votes_.get(vote.getHash()); found) {
+    return valid;
+  }
+  return verifyVoteCrypto(vote);
+}
+
+std::vector<uint8_t> VoteManager::verifyVotesCrypto_(std::vector<Vote> const& votes, bool cache_results) {
+  // Votes not yet checked by verification pool are checked here in parallel
+  std::vector<uint8_t> crypto_valid(votes.size());
+  std::vector<size_t> unchecked;
+  for (size_t i = 0; i < votes.size(); ++i) {
+    if (auto [valid, found] = crypto_checked_votes_.get(votes[i].getHash()); found) {
+      crypto_valid[i] = valid;
+    } else {
+      unchecked.push_back(i);
+    }
+  }
+  if (!unchecked.empty()) {
+    verification_pool_.parallel_for(unchecked.size(), 1, [&](size_t from, size_t to) {
+      for (auto k = from; k < to; ++k) {
+        crypto_valid[unchecked[k]] = verifyVoteCrypto(votes[unchecked[k]]);
+      }
+    });
+    if (cache_results) {
+      for (auto i : unchecked) {
+        crypto_checked_votes_.insert(votes[i].getHash(), crypto_valid[i]);
+      }
+    }
+  }
+  return crypto_valid;
+}
+
 void VoteManager::addUnverifiedVotes(std::vector<Vote> const& votes) {
   for (auto const& v : votes) {
     if (voteInUnverifiedMap(v.getRound(), v.getHash())) {
@@ -222,10 +462,12 @@ void VoteManager::addVerifiedVote(Vote const& vote) {
       }
       upgradeLock_ locked(lock);
       verified_votes_[pbft_round][hash] = vote;
+      verified_votes_index_.insert(vote);
     } else {
       std::unordered_map<vote_hash_t, Vote> votes{std::make_pair(hash, vote)};
       upgradeLock_ locked(lock);
       verified_votes_[pbft_round] = votes;
+      verified_votes_index_.insert(vote);
     }
   }
   LOG(log_dg_) << "Add verified vote " << vote;
@@ -264,6 +506,7 @@ bool VoteManager::voteInVerifiedMap(uint64_t const& pbft_round, vote_hash_t cons
 void VoteManager::clearVerifiedVotesTable() {
   uniqueLock_ lock(verified_votes_access_);
   verified_votes_.clear();
+  verified_votes_index_.clear();
 }
 
 std::vector<Vote> VoteManager::getVerifiedVotes() {
@@ -278,10 +521,41 @@ std::vector<Vote> VoteManager::getVerifiedVotes() {
   return votes;
 }
 
+size_t VoteManager::getVerifiedVotesSize() const {
+  sharedLock_ lock(verified_votes_access_);
+  return verified_votes_index_.size();
+}
+
+std::vector<Vote> VoteManager::getVerifiedVotesOfType(PbftVoteTypes type, uint64_t round, std::optional<size_t> step,
+                                                      std::optional<blk_hash_t> const& blockhash) const {
+  sharedLock_ lock(verified_votes_access_);
+  return verified_votes_index_.getVotes(type, round, step, blockhash);
+}
+
+std::optional<blk_hash_t> VoteManager::blockWithEnoughVotes(PbftVoteTypes type, uint64_t round, size_t step,
+                                                            size_t pbft_2t_plus_1) const {
+  sharedLock_ lock(verified_votes_access_);
+  return verified_votes_index_.blockWithEnoughVotes(type, round, step, pbft_2t_plus_1);
+}
+
+std::optional<std::pair<uint64_t, size_t>> VoteManager::highestRoundStepWithEnoughVotes(PbftVoteTypes type,
+                                                                                        uint64_t from_round,
+                                                                                        size_t pbft_2t_plus_1) const {
+  sharedLock_ lock(verified_votes_access_);
+  return verified_votes_index_.highestRoundStepWithEnoughVotes(type, from_round, pbft_2t_plus_1);
+}
+
 // Return all verified votes >= pbft_round
 std::vector<Vote> VoteManager::getVerifiedVotes(uint64_t const pbft_round, size_t const sortition_threshold,
                                                 uint64_t dpos_total_votes_count,
                                                 std::function<size_t(addr_t const&)> const& dpos_eligible_vote_count) {
+  verifyVotes(pbft_round, sortition_threshold, dpos_total_votes_count, dpos_eligible_vote_count);
+  return getVerifiedVotes();
+}
+
+void VoteManager::verifyVotes(uint64_t const pbft_round, size_t const sortition_threshold,
+                              uint64_t dpos_total_votes_count,
+                              std::function<size_t(addr_t const&)> const& dpos_eligible_vote_count) {
   // Cleanup votes for previous rounds
   cleanupVotes(pbft_round);
 
@@ -300,11 +574,16 @@ std::vector<Vote> VoteManager::getVerifiedVotes(uint64_t const pbft_round, size_
     }
   }
 
-  for (auto const& v : votes_to_verify) {
-    if (votes_invalid_in_current_final_chain_period_.count(v.getHash())) {
-      continue;
-    }
+  votes_to_verify.erase(std::remove_if(votes_to_verify.begin(), votes_to_verify.end(),
+                                       [this](auto const& v) {
+                                         return votes_invalid_in_current_final_chain_period_.count(v.getHash());
+                                       }),
+                        votes_to_verify.end());
+
+  auto const crypto_valid = verifyVotesCrypto_(votes_to_verify, true);
 
+  for (size_t i = 0; i < votes_to_verify.size(); ++i) {
+    auto const& v = votes_to_verify[i];
     bool vote_is_valid = true;
 
     addr_t voter_account_address = v.getVoterAddr();
@@ -318,8 +597,12 @@ std::vector<Vote> VoteManager::getVerifiedVotes(uint64_t const pbft_round, size_
     } else if (vote_weighted_index >= dpos_votes_count) {
       LOG(log_dg_) << "Account " << voter_account_address << " is not eligible to vote. Vote: " << v;
       vote_is_valid = false;
-    } else {
-      vote_is_valid = voteValidation(v, dpos_total_votes_count, sortition_threshold);
+    } else if (!crypto_valid[i]) {
+      vote_is_valid = false;
+    } else if (!v.verifyCanSpeak(sortition_threshold, dpos_total_votes_count)) {
+      LOG(log_er_) << "Vote sortition failed. Sortition threshold " << sortition_threshold
+                   << ", DPOS total votes count " << dpos_total_votes_count << v;
+      vote_is_valid = false;
     }
 
     if (vote_is_valid) {
@@ -352,8 +635,6 @@ std::vector<Vote> VoteManager::getVerifiedVotes(uint64_t const pbft_round, size_
   for (auto const& v : future_unverifiable_votes) {
     removeUnverifiedVote(v.getRound(), v.getHash());
   }
-
-  return getVerifiedVotes();
 }
 
 // cleanup votes < pbft_round
@@ -412,11 +693,14 @@ void VoteManager::cleanupVotes(uint64_t pbft_round) {
     }
   }
 
-  auto batch = db_->createWriteBatch();
-  for (auto const& v_hash : remove_unverified_votes_hash) {
-    db_->removeUnverifiedVoteToBatch(v_hash, batch);
+  // Runs on every PBFT loop pass, mostly there is nothing to remove
+  if (!remove_unverified_votes_hash.empty()) {
+    auto batch = db_->createWriteBatch();
+    for (auto const& v_hash : remove_unverified_votes_hash) {
+      db_->removeUnverifiedVoteToBatch(v_hash, batch);
+    }
+    db_->commitWriteBatch(batch);
   }
-  db_->commitWriteBatch(batch);
 
   // Remove verified votes
   vector<vote_hash_t> remove_verified_votes_hash;
@@ -431,18 +715,19 @@ void VoteManager::cleanupVotes(uint64_t pbft_round) {
       }
       it = verified_votes_.erase(it);
     }
+    verified_votes_index_.eraseRoundsBelow(pbft_round);
   }
 
-  batch = db_->createWriteBatch();
-  for (auto const& v_hash : remove_verified_votes_hash) {
-    db_->removeVerifiedVoteToBatch(v_hash, batch);
+  if (!remove_verified_votes_hash.empty()) {
+    auto batch = db_->createWriteBatch();
+    for (auto const& v_hash : remove_verified_votes_hash) {
+      db_->removeVerifiedVoteToBatch(v_hash, batch);
+    }
+    db_->commitWriteBatch(batch);
   }
-
-  db_->commitWriteBatch(batch);
 }
 
-bool VoteManager::voteValidation(taraxa::Vote const& vote, size_t const dpos_total_votes_count,
-                                 size_t const sortition_threshold) const {
+bool VoteManager::verifyVoteCrypto(Vote const& vote) const {
   if (!vote.getVrfSortition().verify()) {
     LOG(log_er_) << "Invalid vrf proof. " << vote;
     return false;
@@ -453,6 +738,15 @@ bool VoteManager::voteValidation(taraxa::Vote const& vote, size_t const dpos_tot
     return false;
   }
 
+  return true;
+}
+
+bool VoteManager::voteValidation(taraxa::Vote const& vote, size_t const dpos_total_votes_count,
+                                 size_t const sortition_threshold) const {
+  if (!verifyVoteCryptoCached_(vote)) {
+    return false;
+  }
+
   if (!vote.verifyCanSpeak(sortition_threshold, dpos_total_votes_count)) {
     LOG(log_er_) << "Vote sortition failed. Sortition threshold " << sortition_threshold << ", DPOS total votes count "
                  << dpos_total_votes_count << vote;
@@ -464,13 +758,14 @@ bool VoteManager::voteValidation(taraxa::Vote const& vote, size_t const dpos_tot
 
 bool VoteManager::pbftBlockHasEnoughValidCertVotes(PbftBlockCert const& pbft_block_and_votes,
                                                    size_t dpos_total_votes_count, size_t sortition_threshold,
-                                                   size_t pbft_2t_plus_1) const {
+                                                   size_t pbft_2t_plus_1) {
   if (pbft_block_and_votes.cert_votes.empty()) {
     LOG(log_er_) << "No any cert votes! The synced PBFT block comes from a "
                     "malicious player.";
     return false;
   }
 
+  std::vector<Vote> votes_to_verify;
   std::vector<Vote> valid_votes;
   auto first_cert_vote_round = pbft_block_and_votes.cert_votes[0].getRound();
 
@@ -495,7 +790,14 @@ bool VoteManager::pbftBlockHasEnoughValidCertVotes(PbftBlockCert const& pbft_blo
       break;
     }
 
-    if (voteValidation(v, dpos_total_votes_count, sortition_threshold)) {
+    votes_to_verify.emplace_back(v);
+  }
+
+  // Signatures and VRF proofs of the whole certificate are checked in one parallel pass
+  auto const crypto_valid = verifyVotesCrypto_(votes_to_verify, false);
+  for (size_t i = 0; i < votes_to_verify.size(); ++i) {
+    auto const& v = votes_to_verify[i];
+    if (crypto_valid[i] && v.verifyCanSpeak(sortition_threshold, dpos_total_votes_count)) {
       valid_votes.emplace_back(v);
     } else {
       LOG(log_wr_) << "For PBFT block " << pbft_block_and_votes.pbft_blk->getBlockHash() << ", cert vote "
@@ -835,12 +1137,7 @@ void NextVotesForPreviousRound::updateWithSyncedVotes(std::vector<Vote> const& n
 
   if (!update_votes.empty()) {
     // Add new next votes in DB for the PBFT round
-    auto voted_round = update_votes[0].getRound();
-    auto next_votes_in_db = db_->getNextVotes(voted_round);
-    for (auto const& v : update_votes) {
-      next_votes_in_db.emplace_back(v);
-    }
-    db_->saveNextVotes(voted_round, next_votes_in_db);
+    db_->saveNextVotes(update_votes[0].getRound(), update_votes);
 
     addNextVotes(update_votes, pbft_2t_plus_1);
   }
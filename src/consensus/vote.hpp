@@ -3,12 +3,15 @@
 #include <libdevcrypto/Common.h>
 
 #include <deque>
+#include <map>
 #include <optional>
 #include <string>
+#include <unordered_set>
 
 #include "common/types.hpp"
 #include "config/config.hpp"
 #include "consensus/pbft_chain.hpp"
+#include "util/thread_pool.hpp"
 #include "util/util.hpp"
 #include "vrf_wrapper.hpp"
 
@@ -64,7 +67,9 @@ struct VrfPbftSortition : public vrf_wrapper::VrfSortitionBase {
   VrfPbftSortition() = default;
   VrfPbftSortition(vrf_sk_t const& sk, VrfPbftMsg const& pbft_msg)
       : VrfSortitionBase(sk, pbft_msg.getRlpBytes()), pbft_msg(pbft_msg) {}
-  explicit VrfPbftSortition(bytes const& rlp);
+  // Without verify_proof, output is not set until verify() is called
+  explicit VrfPbftSortition(bytes const& rlp, bool verify_proof = true);
+  VrfPbftSortition(vrf_pk_t const& pk, VrfPbftMsg const& pbft_msg, vrf_proof_t const& proof, bool verify_proof = true);
   bytes getRlpBytes() const;
   bool verify() { return VrfSortitionBase::verify(pbft_msg.getRlpBytes()); }
   bool operator==(VrfPbftSortition const& other) const {
@@ -72,6 +77,8 @@ struct VrfPbftSortition : public vrf_wrapper::VrfSortitionBase {
   }
   static inline uint512_t max512bits = std::numeric_limits<uint512_t>::max();
   bool canSpeak(size_t threshold, size_t valid_players) const;
+  // Largest VRF output that can speak, same for the whole period
+  static uint512_t speakBound(size_t threshold, size_t dpos_total_votes_count);
   friend std::ostream& operator<<(std::ostream& strm, VrfPbftSortition const& vrf_sortition) {
     strm << "[VRF sortition] " << std::endl;
     strm << "  pk: " << vrf_sortition.pk << std::endl;
@@ -89,8 +96,9 @@ class Vote {
   Vote() = default;
   Vote(secret_t const& node_sk, VrfPbftSortition const& vrf_sortition, blk_hash_t const& blockhash);
 
-  explicit Vote(dev::RLP const& rlp);
+  explicit Vote(dev::RLP const& rlp, bool verify_vrf = true);
   explicit Vote(bytes const& rlp);
+  Vote(blk_hash_t const& blockhash, VrfPbftSortition const& vrf_sortition, sig_t const& vote_signature);
   bool operator==(Vote const& other) const { return rlp() == other.rlp(); }
   ~Vote() {}
 
@@ -143,6 +151,61 @@ class Vote {
   mutable addr_t cached_voter_addr_;
 };
 
+/**
+ * Cert votes of a PBFT block. Votes of a valid certificate share round, step, type and voted block, so they are
+ * encoded once, the block hash is taken from the certified block:
+ *   [version, round, step, type, [[pk, weighted_index, proof, signature], ...]]
+ * Certificates with votes that differ in any of the shared fields use legacy encoding, a list of full votes. Both
+ * encodings are decoded.
+ */
+bytes encodeCertVotes(blk_hash_t const& pbft_block_hash, std::vector<Vote> const& cert_votes);
+// Votes decoded without verify_vrf have VRF output not set, they are only good to be checked by VoteManager
+std::vector<Vote> decodeCertVotes(blk_hash_t const& pbft_block_hash, dev::RLP const& rlp, bool verify_vrf = true);
+
+/**
+ * Index of verified votes by round, step and type, with running tallies of votes per voted block. Tallies are updated
+ * on insert, so quorum checks don't depend on the number of retained votes. Not thread safe, VoteManager guards it.
+ */
+class VoteIndex {
+ public:
+  // Returns false if the vote is indexed already
+  bool insert(Vote const& vote);
+  void eraseRoundsBelow(uint64_t round);
+  void clear();
+  size_t size() const { return size_; }
+
+  // Votes of all steps of the round if step is not specified, votes for any block if blockhash is not specified
+  std::vector<Vote> getVotes(PbftVoteTypes type, uint64_t round, std::optional<size_t> step = std::nullopt,
+                             std::optional<blk_hash_t> const& blockhash = std::nullopt) const;
+  // Block with the most votes in (type, round, step) if it has at least threshold votes
+  std::optional<blk_hash_t> blockWithEnoughVotes(PbftVoteTypes type, uint64_t round, size_t step,
+                                                 size_t threshold) const;
+  // Highest <round, step> from from_round on, where a block has at least threshold votes of type
+  std::optional<std::pair<uint64_t, size_t>> highestRoundStepWithEnoughVotes(PbftVoteTypes type, uint64_t from_round,
+                                                                             size_t threshold) const;
+
+ private:
+  struct Tally {
+    std::unordered_map<blk_hash_t, std::vector<Vote>> votes_by_block;
+    blk_hash_t top_block;
+    size_t top_votes = 0;
+  };
+  struct Round {
+    std::unordered_set<vote_hash_t> hashes;
+    // <<step, type>, tally>
+    std::map<std::pair<size_t, PbftVoteTypes>, Tally> tallies;
+  };
+
+  std::map<uint64_t, Round> rounds_;
+  size_t size_ = 0;
+};
+
+/**
+ * Votes received from network are unverified until PBFT manager verifies them against DPOS state of the current
+ * period. Signature and VRF proof checks don't depend on DPOS state and are the expensive part, so they are done in
+ * parallel on verification pool as votes arrive, and their results are cached by vote hash until the vote is cleaned
+ * up. PBFT loop then only checks eligibility and sortition of votes.
+ */
 class VoteManager {
  public:
   VoteManager(addr_t node_addr, std::shared_ptr<DbStorage> db, std::shared_ptr<FinalChain> final_chain,
@@ -168,13 +231,28 @@ class VoteManager {
   std::vector<Vote> getVerifiedVotes(uint64_t const pbft_round, size_t const sortition_threshold,
                                      uint64_t dpos_total_votes_count,
                                      std::function<size_t(addr_t const&)> const& dpos_eligible_vote_count);
+  // Verifies unverified votes, same as getVerifiedVotes() without copying all verified votes out
+  void verifyVotes(uint64_t const pbft_round, size_t const sortition_threshold, uint64_t dpos_total_votes_count,
+                   std::function<size_t(addr_t const&)> const& dpos_eligible_vote_count);
+  size_t getVerifiedVotesSize() const;
+  std::vector<Vote> getVerifiedVotesOfType(PbftVoteTypes type, uint64_t round,
+                                           std::optional<size_t> step = std::nullopt,
+                                           std::optional<blk_hash_t> const& blockhash = std::nullopt) const;
+  std::optional<blk_hash_t> blockWithEnoughVotes(PbftVoteTypes type, uint64_t round, size_t step,
+                                                 size_t pbft_2t_plus_1) const;
+  std::optional<std::pair<uint64_t, size_t>> highestRoundStepWithEnoughVotes(PbftVoteTypes type, uint64_t from_round,
+                                                                             size_t pbft_2t_plus_1) const;
 
   void cleanupVotes(uint64_t pbft_round);
 
   bool voteValidation(Vote const& vote, size_t const valid_sortition_players, size_t const sortition_threshold) const;
+  // Checks VRF proof and signature of the vote, doesn't depend on DPOS state
+  bool verifyVoteCrypto(Vote const& vote) const;
+  // Checks crypto of the votes on the verification pool, results are used by voteValidation later
+  void verifyVotesCryptoAsync(std::vector<Vote> const& votes);
 
   bool pbftBlockHasEnoughValidCertVotes(PbftBlockCert const& pbft_block_and_votes, size_t valid_sortition_players,
-                                        size_t sortition_threshold, size_t pbft_2t_plus_1) const;
+                                        size_t sortition_threshold, size_t pbft_2t_plus_1);
 
   std::string getJsonStr(std::vector<Vote> const& votes);
 
@@ -187,6 +265,7 @@ class VoteManager {
   // <pbft_round, <vote_hash, vote>>
   std::map<uint64_t, std::unordered_map<vote_hash_t, Vote>> unverified_votes_;
   std::map<uint64_t, std::unordered_map<vote_hash_t, Vote>> verified_votes_;
+  VoteIndex verified_votes_index_;
 
   std::unordered_set<vote_hash_t> votes_invalid_in_current_final_chain_period_;
   h256 current_period_final_chain_block_hash_;
@@ -195,11 +274,28 @@ class VoteManager {
   mutable boost::shared_mutex unverified_votes_access_;
   mutable boost::shared_mutex verified_votes_access_;
 
+  // <vote_hash, signature and VRF proof are valid>, validity never changes for the vote hash, so results are only
+  // dropped once the cache is full
+  static constexpr uint32_t c_max_crypto_checked_votes = 100000;
+  ExpirationCacheMap<vote_hash_t, bool> crypto_checked_votes_{c_max_crypto_checked_votes,
+                                                              c_max_crypto_checked_votes / 100};
+
   std::shared_ptr<DbStorage> db_;
   std::shared_ptr<PbftChain> pbft_chain_;
   std::shared_ptr<FinalChain> final_chain_;
 
   LOG_OBJECTS_DEFINE
+
+  // Result of a queued vote is cached only if the vote is still in unverified queue once checked, results of other
+  // votes (cert votes of synced blocks) are always cached
+  void verifyVoteCryptoAsync_(Vote const& vote, bool queued);
+  // Crypto check results of all votes, cached results are used and votes not checked yet are checked in parallel
+  std::vector<uint8_t> verifyVotesCrypto_(std::vector<Vote> const& votes, bool cache_results);
+  // Result of the check done on the verification pool if there is one
+  bool verifyVoteCryptoCached_(Vote const& vote) const;
+
+  // Declared last to stop before the state its tasks use is destroyed
+  util::ThreadPool verification_pool_{std::max(1u, std::thread::hardware_concurrency() / 2)};
 };
 
 class NextVotesForPreviousRound {
@@ -1,7 +1,23 @@
 #include "vrf_wrapper.hpp"
 
+#include <libdevcore/SHA3.h>
+
 namespace taraxa::vrf_wrapper {
 
+namespace {
+
+constexpr uint32_t c_verified_outputs_cache_size = 50000;
+constexpr uint32_t c_verified_outputs_cache_delete_step = 500;
+
+// <sha3(pk, proof, msg), output> of valid proofs, votes and blocks are verified again after each finalized period
+ExpirationCacheMap<dev::h256, vrf_output_t> &verifiedOutputs() {
+  static ExpirationCacheMap<dev::h256, vrf_output_t> cache(c_verified_outputs_cache_size,
+                                                           c_verified_outputs_cache_delete_step);
+  return cache;
+}
+
+}  // namespace
+
 std::pair<vrf_pk_t, vrf_sk_t> getVrfKeyPair() {
   vrf_sk_t sk;
   vrf_pk_t pk;
@@ -38,6 +54,18 @@ std::optional<vrf_output_t> getVrfOutput(vrf_pk_t const &pk, vrf_proof_t const &
 }
 
 bool VrfSortitionBase::verify(bytes const &msg) {
+  bytes key_bytes;
+  key_bytes.reserve(pk.size + proof.size + msg.size());
+  key_bytes.insert(key_bytes.end(), pk.begin(), pk.end());
+  key_bytes.insert(key_bytes.end(), proof.begin(), proof.end());
+  key_bytes.insert(key_bytes.end(), msg.begin(), msg.end());
+  auto const key = dev::sha3(key_bytes);
+  if (auto [cached_output, found] = verifiedOutputs().get(key); found) {
+    output = cached_output;
+    thresholdFromOutput();
+    return true;
+  }
+
   if (!isValidVrfPublicKey(pk)) {
     return false;
   }
@@ -45,6 +73,7 @@ bool VrfSortitionBase::verify(bytes const &msg) {
   if (res != std::nullopt) {
     output = res.value();
     thresholdFromOutput();
+    verifiedOutputs().insert(key, output);
     return true;
   }
   return false;
@@ -32,6 +32,7 @@ struct VrfSortitionBase {
     output = vrf_wrapper::getVrfOutput(pk, proof, msg).value();
     thresholdFromOutput();
   }
+  // Verified proofs are cached, so verifying the same proof of the same message again is cheap
   bool verify(bytes const &msg);
   bool operator==(VrfSortitionBase const &other) const {
     return pk == other.pk && proof == other.proof && output == other.output;
@@ -122,16 +122,14 @@ void Network::onNewBlockVerified(shared_ptr<DagBlock> const &blk) {
   });
 }
 
-void Network::onNewTransactions(std::vector<taraxa::bytes> transactions) {
+void Network::onNewTransactions(std::vector<Transaction> transactions) {
   tp_.post([=, transactions = std::move(transactions)] {
     taraxa_capability_->onNewTransactions(transactions, true);
     LOG(log_dg_) << "On new transactions" << transactions.size();
   });
 }
 
-void Network::restartSyncingPbft(bool force) {
-  tp_.post([=] { taraxa_capability_->restartSyncingPbft(force); });
-}
+void Network::restartSyncingPbft(bool force) { taraxa_capability_->restartSyncingPbftAsync(force); }
 
 void Network::onNewPbftBlock(std::shared_ptr<PbftBlock> const &pbft_block) {
   tp_.post([=] {
@@ -0,0 +1,129 @@
+#include "pbft_sync_scheduler.hpp"
+
+#include <algorithm>
+
+namespace taraxa {
+
+PbftSyncScheduler::PbftSyncScheduler(size_t range_size, size_t max_peers, uint64_t timeout_ms)
+    : range_size_(std::max<size_t>(range_size, 1)), max_peers_(std::max<size_t>(max_peers, 1)), timeout_ms_(timeout_ms) {}
+
+void PbftSyncScheduler::start(uint64_t synced_period) {
+  stop();
+  active_ = true;
+  next_period_ = next_unrequested_ = synced_period + 1;
+}
+
+void PbftSyncScheduler::stop() {
+  active_ = false;
+  requeued_.clear();
+  in_flight_.clear();
+  slow_peers_.clear();
+  known_chain_sizes_.clear();
+  ready_.clear();
+}
+
+std::vector<PbftSyncScheduler::Request> PbftSyncScheduler::schedule(
+    std::vector<std::pair<NodeID, uint64_t>> const& peer_chain_sizes, uint64_t now_ms) {
+  std::vector<Request> requests;
+  if (!active_) {
+    return requests;
+  }
+  for (auto it = in_flight_.begin(); it != in_flight_.end();) {
+    if (it->second.deadline_ms <= now_ms) {
+      slow_peers_.insert(it->first);
+      requeue(it->second.from, it->second.count);
+      it = in_flight_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  auto assign = [&] {
+    for (auto const& [peer, reported_chain_size] : peer_chain_sizes) {
+      if (in_flight_.size() >= max_peers_) {
+        break;
+      }
+      if (in_flight_.count(peer) || slow_peers_.count(peer)) {
+        continue;
+      }
+      auto chain_size = reported_chain_size;
+      if (auto it = known_chain_sizes_.find(peer); it != known_chain_sizes_.end()) {
+        chain_size = std::min(chain_size, it->second);
+      }
+      if (auto range = nextRange(chain_size)) {
+        in_flight_[peer] = InFlight{range->first, range->second, now_ms + timeout_ms_};
+        requests.push_back(Request{peer, range->first, range->second});
+      }
+    }
+  };
+  assign();
+  // Slow peers are better than none
+  if (in_flight_.empty() && !slow_peers_.empty()) {
+    slow_peers_.clear();
+    assign();
+  }
+  return requests;
+}
+
+std::optional<PbftSyncScheduler::Request> PbftSyncScheduler::onResponse(NodeID const& peer, size_t count,
+                                                                         uint64_t first_period, bytes packet) {
+  slow_peers_.erase(peer);
+  auto it = in_flight_.find(peer);
+  if (it == in_flight_.end()) {
+    return std::nullopt;
+  }
+  // Not an answer to the current request, which stays in flight
+  if (count && first_period != it->second.from) {
+    return std::nullopt;
+  }
+  Request request{peer, it->second.from, it->second.count};
+  in_flight_.erase(it);
+  count = std::min(count, request.count);
+  if (count < request.count) {
+    known_chain_sizes_[peer] = request.from + count - 1;
+    requeue(request.from + count, request.count - count);
+  }
+  if (count) {
+    ready_[request.from] = Response{peer, request.from, count, std::move(packet)};
+  }
+  return request;
+}
+
+void PbftSyncScheduler::onPeerDisconnected(NodeID const& peer) {
+  if (auto it = in_flight_.find(peer); it != in_flight_.end()) {
+    requeue(it->second.from, it->second.count);
+    in_flight_.erase(it);
+  }
+  slow_peers_.erase(peer);
+  known_chain_sizes_.erase(peer);
+}
+
+std::vector<PbftSyncScheduler::Response> PbftSyncScheduler::popReady() {
+  std::vector<Response> ret;
+  for (auto it = ready_.begin(); it != ready_.end() && it->first == next_period_; it = ready_.erase(it)) {
+    next_period_ += it->second.count;
+    ret.push_back(std::move(it->second));
+  }
+  return ret;
+}
+
+void PbftSyncScheduler::requeue(uint64_t from, size_t count) { requeued_[from] = count; }
+
+std::optional<std::pair<uint64_t, size_t>> PbftSyncScheduler::nextRange(uint64_t peer_chain_size) {
+  // Requeued ranges hold back processing of the ranges after them, so they go first
+  for (auto it = requeued_.begin(); it != requeued_.end(); ++it) {
+    if (it->first <= peer_chain_size) {
+      auto range = *it;
+      requeued_.erase(it);
+      return range;
+    }
+  }
+  if (peer_chain_size < next_unrequested_ || next_period_ + max_peers_ * range_size_ <= next_unrequested_) {
+    return std::nullopt;
+  }
+  auto const count = std::min<uint64_t>(range_size_, peer_chain_size - next_unrequested_ + 1);
+  auto const from = next_unrequested_;
+  next_unrequested_ += count;
+  return std::make_pair(from, count);
+}
+
+}  // namespace taraxa
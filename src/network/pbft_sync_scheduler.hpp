@@ -0,0 +1,96 @@
+#pragma once
+
+#include <libp2p/Common.h>
+
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/types.hpp"
+
+namespace taraxa {
+
+/**
+ * Schedules PBFT chain sync across peers. Periods to sync are split into ranges, each peer downloads one range at a
+ * time so ranges from different peers download concurrently. Responses are buffered and released in period order.
+ * A range not answered in time is requested from another peer, and the slow peer gets no more ranges until it answers.
+ *
+ * Not thread safe, used on network thread only.
+ */
+class PbftSyncScheduler {
+ public:
+  using NodeID = dev::p2p::NodeID;
+
+  struct Request {
+    NodeID peer;
+    uint64_t from;
+    size_t count;
+  };
+
+  struct Response {
+    NodeID peer;
+    uint64_t from;
+    // Number of PBFT blocks in the packet
+    size_t count;
+    bytes packet;
+  };
+
+  /**
+   * @param range_size PBFT blocks requested at once from a peer
+   * @param max_peers peers downloading at the same time
+   * @param timeout_ms time after which a range is requested from another peer
+   */
+  PbftSyncScheduler(size_t range_size, size_t max_peers, uint64_t timeout_ms);
+
+  // Starts syncing the periods after synced_period, drops state of the previous sync
+  void start(uint64_t synced_period);
+  void stop();
+  bool active() const { return active_; }
+  // Nothing is requested or buffered, sync is over if schedule() requests nothing either
+  bool idle() const { return in_flight_.empty() && ready_.empty(); }
+
+  // Assigns ranges to idle peers, and ranges of timed out requests to other peers. Ranges are not scheduled more than
+  // max_peers ranges ahead of the next period to process, so the buffer is bounded.
+  std::vector<Request> schedule(std::vector<std::pair<NodeID, uint64_t>> const& peer_chain_sizes, uint64_t now_ms);
+  // Returns the request the response is for, nothing if no range is requested from the peer, e.g. when its request
+  // has timed out, or if the response starts at another period than the request, e.g. a late answer to a timed out
+  // request. Periods missing in the response are requested again, from another peer.
+  std::optional<Request> onResponse(NodeID const& peer, size_t count, uint64_t first_period, bytes packet);
+  void onPeerDisconnected(NodeID const& peer);
+  // Buffered responses starting from the next period to process, in period order
+  std::vector<Response> popReady();
+  // Next period to process
+  uint64_t nextPeriod() const { return next_period_; }
+  size_t inFlight() const { return in_flight_.size(); }
+
+ private:
+  struct InFlight {
+    uint64_t from;
+    size_t count;
+    uint64_t deadline_ms;
+  };
+
+  void requeue(uint64_t from, size_t count);
+  std::optional<std::pair<uint64_t, size_t>> nextRange(uint64_t peer_chain_size);
+
+  size_t const range_size_;
+  size_t const max_peers_;
+  uint64_t const timeout_ms_;
+
+  bool active_ = false;
+  uint64_t next_period_ = 0;
+  // First period never requested yet
+  uint64_t next_unrequested_ = 0;
+  // Ranges to request again, <from, count>
+  std::map<uint64_t, size_t> requeued_;
+  std::unordered_map<NodeID, InFlight> in_flight_;
+  // Timed out peers, they get ranges again after they answer
+  std::unordered_set<NodeID> slow_peers_;
+  // Peers which responded with fewer blocks than requested, <peer, their chain size>
+  std::unordered_map<NodeID, uint64_t> known_chain_sizes_;
+  std::map<uint64_t, Response> ready_;
+};
+
+}  // namespace taraxa
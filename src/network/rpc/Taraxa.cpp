@@ -141,4 +141,70 @@ Json::Value Taraxa::taraxa_queryDPOS(Json::Value const& _q) {
   return enc_json(res, &q);
 }
 
-}  // namespace taraxa::net
\ No newline at end of file
+Json::Value Taraxa::taraxa_sendRawTransactions(Json::Value const& _rlps) {
+  auto node = tryGetNode();
+  auto const& rpc_config = node->getConfig().rpc;
+  auto const max_batch = rpc_config ? rpc_config->max_raw_transactions_batch : RpcConfig().max_raw_transactions_batch;
+  if (_rlps.size() > max_batch) {
+    BOOST_THROW_EXCEPTION(JsonRpcException(Errors::ERROR_RPC_INVALID_PARAMS,
+                                           "Too many transactions in batch, max is " + std::to_string(max_batch)));
+  }
+
+  std::vector<taraxa::bytes> raw_trxs;
+  raw_trxs.reserve(_rlps.size());
+  try {
+    for (auto const& rlp : _rlps) {
+      raw_trxs.emplace_back(jsToBytes(rlp.asString(), OnFailed::Throw));
+    }
+  } catch (...) {
+    BOOST_THROW_EXCEPTION(JsonRpcException(Errors::ERROR_RPC_INVALID_PARAMS));
+  }
+
+  auto results = node->getTransactionManager()->insertRawTransactions(raw_trxs);
+  auto res = Json::Value(Json::arrayValue);
+  for (auto const& [hash, error] : results) {
+    Json::Value item(Json::objectValue);
+    item["hash"] = hash == trx_hash_t() ? Json::Value() : Json::Value(toJS(hash));
+    if (!error.empty()) {
+      item["error"] = error;
+    }
+    res.append(item);
+  }
+  return res;
+}
+
+Json::Value Taraxa::taraxa_getAccounts(Json::Value const& _addresses, std::string const& _blockNumber) {
+  std::vector<addr_t> addrs;
+  std::optional<BlockNumber> blk_n;
+  addrs.reserve(_addresses.size());
+  try {
+    for (auto const& addr : _addresses) {
+      addrs.emplace_back(jsToAddress(addr.asString()));
+    }
+    if (_blockNumber != "latest" && _blockNumber != "pending") {
+      blk_n = jsToInt(_blockNumber);
+    }
+  } catch (...) {
+    BOOST_THROW_EXCEPTION(JsonRpcException(Errors::ERROR_RPC_INVALID_PARAMS));
+  }
+
+  auto accounts = tryGetNode()->getFinalChain()->get_accounts(addrs, blk_n);
+  auto res = Json::Value(Json::arrayValue);
+  for (auto const& acc : accounts) {
+    if (!acc) {
+      res.append(Json::Value());
+      continue;
+    }
+    Json::Value item(Json::objectValue);
+    item["balance"] = toJS(acc->Balance);
+    item["nonce"] = toJS(acc->Nonce);
+    item["code_hash"] = toJS(acc->code_hash_eth());
+    item["storage_root_hash"] = toJS(acc->storage_root_eth());
+    res.append(item);
+  }
+  return res;
+}
+
+Json::Value Taraxa::taraxa_getConsensusMetrics() { return tryGetNode()->getPbftManager()->getMetrics().getJson(); }
+
+}  // namespace taraxa::net
@@ -27,6 +27,9 @@ class Taraxa : public TaraxaFace {
   virtual Json::Value taraxa_getScheduleBlockByPeriod(std::string const& _period) override;
   Json::Value taraxa_getConfig() override;
   Json::Value taraxa_queryDPOS(Json::Value const& _q) override;
+  Json::Value taraxa_sendRawTransactions(Json::Value const& _rlps) override;
+  Json::Value taraxa_getAccounts(Json::Value const& _addresses, std::string const& _blockNumber) override;
+  Json::Value taraxa_getConsensusMetrics() override;
 
  protected:
   std::weak_ptr<taraxa::FullNode> full_node_;
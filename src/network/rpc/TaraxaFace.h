@@ -37,6 +37,15 @@ class TaraxaFace : public ServerInterface<TaraxaFace> {
     this->bindAndAddMethod(jsonrpc::Procedure("taraxa_queryDPOS", jsonrpc::PARAMS_BY_POSITION, jsonrpc::JSON_OBJECT,
                                               "param1", jsonrpc::JSON_OBJECT, NULL),
                            &taraxa::net::TaraxaFace::taraxa_queryDPOSI);
+    this->bindAndAddMethod(jsonrpc::Procedure("taraxa_sendRawTransactions", jsonrpc::PARAMS_BY_POSITION,
+                                              jsonrpc::JSON_ARRAY, "param1", jsonrpc::JSON_ARRAY, NULL),
+                           &taraxa::net::TaraxaFace::taraxa_sendRawTransactionsI);
+    this->bindAndAddMethod(jsonrpc::Procedure("taraxa_getAccounts", jsonrpc::PARAMS_BY_POSITION, jsonrpc::JSON_ARRAY,
+                                              "param1", jsonrpc::JSON_ARRAY, "param2", jsonrpc::JSON_STRING, NULL),
+                           &taraxa::net::TaraxaFace::taraxa_getAccountsI);
+    this->bindAndAddMethod(
+        jsonrpc::Procedure("taraxa_getConsensusMetrics", jsonrpc::PARAMS_BY_POSITION, jsonrpc::JSON_OBJECT, NULL),
+        &taraxa::net::TaraxaFace::taraxa_getConsensusMetricsI);
   }
 
   inline virtual void taraxa_protocolVersionI(const Json::Value &request, Json::Value &response) {
@@ -67,6 +76,16 @@ class TaraxaFace : public ServerInterface<TaraxaFace> {
   inline virtual void taraxa_queryDPOSI(const Json::Value &request, Json::Value &response) {
     response = this->taraxa_queryDPOS(request[0u]);
   }
+  inline virtual void taraxa_sendRawTransactionsI(const Json::Value &request, Json::Value &response) {
+    response = this->taraxa_sendRawTransactions(request[0u]);
+  }
+  inline virtual void taraxa_getAccountsI(const Json::Value &request, Json::Value &response) {
+    response = this->taraxa_getAccounts(request[0u], request[1u].asString());
+  }
+  inline virtual void taraxa_getConsensusMetricsI(const Json::Value &request, Json::Value &response) {
+    (void)request;
+    response = this->taraxa_getConsensusMetrics();
+  }
   virtual std::string taraxa_protocolVersion() = 0;
   virtual Json::Value taraxa_getDagBlockByHash(const std::string &param1, bool param2) = 0;
   virtual Json::Value taraxa_getDagBlockByLevel(const std::string &param1, bool param2) = 0;
@@ -75,6 +94,9 @@ class TaraxaFace : public ServerInterface<TaraxaFace> {
   virtual Json::Value taraxa_getScheduleBlockByPeriod(const std::string &param1) = 0;
   virtual Json::Value taraxa_getConfig() = 0;
   virtual Json::Value taraxa_queryDPOS(const Json::Value &param1) = 0;
+  virtual Json::Value taraxa_sendRawTransactions(const Json::Value &param1) = 0;
+  virtual Json::Value taraxa_getAccounts(const Json::Value &param1, const std::string &param2) = 0;
+  virtual Json::Value taraxa_getConsensusMetrics() = 0;
 };
 
 }  // namespace net
@@ -208,6 +208,11 @@ Json::Value Test::get_node_status() {
       res["blk_queue_unverified_size"] = Json::UInt64(node->getDagBlockManager()->getDagBlockQueueSize().first);
       res["blk_queue_verified_size"] = Json::UInt64(node->getDagBlockManager()->getDagBlockQueueSize().second);
       res["network"] = node->getNetwork()->getStatus();
+      auto const state_cache_stats = node->getFinalChain()->state_cache_stats();
+      res["state_cache"]["hits"] = Json::UInt64(state_cache_stats.hits);
+      res["state_cache"]["misses"] = Json::UInt64(state_cache_stats.misses);
+      res["state_cache"]["entries"] = Json::UInt64(state_cache_stats.entries);
+      res["state_cache"]["size_bytes"] = Json::UInt64(state_cache_stats.size_bytes);
     }
   } catch (std::exception &e) {
     res["status"] = e.what();
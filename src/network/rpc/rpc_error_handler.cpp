@@ -3,6 +3,7 @@
 #include <json/json.h>
 
 #include "chain/state_api.hpp"
+#include "chain/state_call_pool.hpp"
 
 namespace taraxa::net {
 
@@ -13,6 +14,9 @@ RpcServer::Error handle_rpc_error() {
   } catch (state_api::ErrFutureBlock const& ex) {
     err.code = jsonrpc::Errors::ERROR_RPC_INVALID_PARAMS;
     err.message << ex.what();
+  } catch (final_chain::ErrCallRejected const& ex) {
+    err.code = jsonrpc::Errors::ERROR_RPC_INTERNAL_ERROR;
+    err.message << ex.what();
   }
   return err;
 }
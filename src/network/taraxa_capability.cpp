@@ -26,6 +26,7 @@ TaraxaCapability::TaraxaCapability(weak_ptr<Host> _host, NetworkConfig const &_c
       trx_mgr_(trx_mgr),
       lambda_ms_min_(pbft_mgr_ ? pbft_mgr_->getPbftInitialLambda() : 2000),
       conf_(_conf),
+      pbft_sync_scheduler_(conf_.network_sync_level_size, conf_.network_pbft_sync_peers, c_pbft_sync_request_timeout_ms),
       urng_(std::mt19937_64(std::random_device()())),
       delay_rng_(std::mt19937(std::random_device()())),
       random_dist_(std::uniform_int_distribution<std::mt19937::result_type>(90, 110)) {
@@ -79,9 +80,66 @@ void TaraxaCapability::insertPeer(NodeID const &node_id) {
   peers_.emplace(std::make_pair(node_id, std::make_shared<TaraxaPeer>(node_id)));
 }
 
-void TaraxaCapability::syncPeerPbft(NodeID const &_nodeID, unsigned long height_to_sync) {
-  LOG(log_nf_pbft_sync_) << "Sync peer node " << _nodeID << " from pbft chain height " << height_to_sync;
-  requestPbftBlocks(_nodeID, height_to_sync);
+void TaraxaCapability::syncPeersPbft() {
+  if (!syncing_) {
+    return;
+  }
+  auto pbft_sync_period = pbft_chain_->pbftSyncingPeriod();
+  if (pbft_sync_period > pbft_chain_->getPbftChainSize() + (10 * conf_.network_sync_level_size)) {
+    // Downloads stop as well, scheduler doesn't request ranges too far ahead of the processed ones
+    if (!pbft_sync_delayed_) {
+      LOG(log_dg_pbft_sync_) << "Syncing pbft blocks too fast than processing. Has synced period " << pbft_sync_period
+                             << ", PBFT chain size " << pbft_chain_->getPbftChainSize();
+      pbft_sync_delayed_ = true;
+      tp_.post(1000, [this] { delayedPbftSync(1); });
+    }
+    return;
+  }
+  for (auto const &response : pbft_sync_scheduler_.popReady()) {
+    if (!processSyncedPbftBlocks_(response.peer, RLP(response.packet))) {
+      LOG(log_dg_pbft_sync_) << "Syncing PBFT is stopping";
+      pbft_sync_scheduler_.stop();
+      syncing_ = false;
+      return;
+    }
+  }
+
+  std::vector<std::pair<NodeID, uint64_t>> peer_chain_sizes;
+  {
+    boost::shared_lock<boost::shared_mutex> lock(peers_mutex_);
+    for (auto const &peer : peers_) {
+      if (peer.second->passed_initial_) {
+        peer_chain_sizes.emplace_back(peer.first, peer.second->pbft_chain_size_);
+      }
+    }
+  }
+  // Peers with longer chains first, they can serve any range
+  std::sort(peer_chain_sizes.begin(), peer_chain_sizes.end(),
+            [](auto const &a, auto const &b) { return a.second > b.second; });
+  auto const requests = pbft_sync_scheduler_.schedule(peer_chain_sizes, getCurrentTimeMilliSeconds());
+  for (auto const &request : requests) {
+    LOG(log_nf_pbft_sync_) << "Sync peer node " << request.peer << " from pbft chain height " << request.from
+                           << ", " << request.count << " blocks";
+    requestPbftBlocks(request.peer, request.from, request.count);
+  }
+  if (!requests.empty()) {
+    // Timed out requests are reassigned
+    tp_.post(c_pbft_sync_request_timeout_ms, [this] { syncPeersPbft(); });
+  }
+  if (pbft_sync_scheduler_.idle()) {
+    LOG(log_dg_pbft_sync_) << "Syncing PBFT is completed";
+    pbft_sync_scheduler_.stop();
+    // We are pbft synced with the nodes we are connected to but
+    // calling restartSyncingPbft will check if some nodes have
+    // greater pbft chain size and we should continue syncing with
+    // them, Or sync pending DAG blocks
+    restartSyncingPbft(true);
+    // We are pbft synced, send message to other node to start
+    // gossiping new blocks
+    if (!syncing_) {
+      sendSyncedMessage();
+    }
+  }
 }
 
 void TaraxaCapability::sealAndSend(NodeID const &nodeID, unsigned packet_type, RLPStream rlp) {
@@ -422,21 +480,102 @@ void TaraxaCapability::interpretCapabilityPacketImpl(NodeID const &_nodeID, unsi
       break;
     }
     case TransactionPacket: {
-      std::string receivedTransactions;
       std::vector<taraxa::bytes> transactions;
-      auto transactionCount = _r.itemCount();
-      for (size_t iTransaction = 0; iTransaction < transactionCount; iTransaction++) {
-        Transaction transaction(_r[iTransaction].data().toBytes());
-        receivedTransactions += transaction.getHash().toString() + " ";
-        peer->markTransactionAsKnown(transaction.getHash());
-        transactions.emplace_back(_r[iTransaction].data().toBytes());
+      transactions.reserve(_r.itemCount());
+      for (auto const &transaction : _r) {
+        transactions.emplace_back(transaction.data().toBytes());
+      }
+      if (transactions.empty()) {
+        break;
+      }
+      LOG(log_dg_trx_prp_) << "Received TransactionPacket with " << transactions.size() << " transactions";
+      received_trx_count += transactions.size();
+
+      if (dag_blk_mgr_) {
+        // Transactions are decoded only once, on the verification pool. Peer is marked to know them before they are
+        // broadcasted further, requests of them time out in doBackgroundWork
+        trx_mgr_->insertBroadcastedTransactions(
+            std::move(transactions),
+            [peer](vec_trx_t const &hashes) {
+              for (auto const &hash : hashes) {
+                peer->markTransactionAsKnown(hash);
+              }
+            },
+            [this](uint32_t inserted) { unique_received_trx_count += inserted; });
+        break;
+      }
+
+      std::string receivedTransactions;
+      std::vector<Transaction> decoded;
+      decoded.reserve(transactions.size());
+      for (auto &transaction : transactions) {
+        auto const &hash = decoded.emplace_back(std::move(transaction)).getHash();
+        receivedTransactions += hash.toString() + " ";
+        peer->markTransactionAsKnown(hash);
+        requested_transactions_.erase(hash);
       }
-      if (transactionCount > 0) {
-        LOG(log_dg_trx_prp_) << "Received TransactionPacket with " << _r.itemCount() << " transactions";
-        LOG(log_tr_trx_prp_) << "Received TransactionPacket with " << _r.itemCount()
-                             << " transactions:" << receivedTransactions.c_str();
+      LOG(log_tr_trx_prp_) << "Received TransactionPacket with " << decoded.size()
+                           << " transactions:" << receivedTransactions.c_str();
+      onNewTransactions(decoded, true);
+      break;
+    }
+    case NewTransactionHashesPacket: {
+      vec_trx_t announced;
+      announced.reserve(_r.itemCount());
+      for (auto const &item : _r) {
+        trx_hash_t hash(item);
+        peer->markTransactionAsKnown(hash);
+        announced.push_back(hash);
+      }
+      LOG(log_dg_trx_prp_) << "Received NewTransactionHashesPacket with " << announced.size() << " transactions";
 
-        onNewTransactions(transactions, true);
+      vec_trx_t unknown;
+      if (dag_blk_mgr_) {
+        unknown = trx_mgr_->filterUnseenTransactions(announced);
+      } else {
+        std::copy_if(announced.begin(), announced.end(), std::back_inserter(unknown),
+                     [this](auto const &hash) { return test_transactions_.find(hash) == test_transactions_.end(); });
+      }
+
+      // Request each transaction only from the first peer that announced it, unless the request timed out
+      vec_trx_t toRequest;
+      auto const now = getCurrentTimeMilliSeconds();
+      for (auto const &hash : unknown) {
+        auto [it, inserted] = requested_transactions_.emplace(hash, now);
+        if (inserted || now - it->second > c_transaction_request_timeout_ms) {
+          it->second = now;
+          toRequest.push_back(hash);
+        }
+      }
+      if (!toRequest.empty()) {
+        packet_stats.is_unique_ = true;
+        requestTransactions(_nodeID, toRequest);
+      }
+      break;
+    }
+    case GetTransactionsPacket: {
+      // Each requested transaction costs db lookup, only the first c_max_transactions_in_request are served
+      auto const requested_count = std::min(_r.itemCount(), c_max_transactions_in_request);
+      if (requested_count < _r.itemCount()) {
+        LOG(log_wr_trx_prp_) << "GetTransactionsPacket from " << _nodeID << " requests " << _r.itemCount()
+                             << " transactions, only " << requested_count << " are served";
+      }
+      std::vector<taraxa::bytes> transactions;
+      for (size_t idx = 0; idx < requested_count; idx++) {
+        trx_hash_t hash(_r[idx]);
+        if (dag_blk_mgr_) {
+          if (auto transaction = trx_mgr_->getTransaction(hash)) {
+            transactions.push_back(std::move(transaction->second));
+          }
+        } else if (auto transaction = test_transactions_.find(hash); transaction != test_transactions_.end()) {
+          transactions.push_back(*transaction->second.rlp());
+        }
+        peer->markTransactionAsKnown(hash);
+      }
+      LOG(log_dg_trx_prp_) << "Received GetTransactionsPacket for " << _r.itemCount() << " transactions, "
+                           << transactions.size() << " found";
+      if (!transactions.empty()) {
+        sendTransactions(_nodeID, transactions);
       }
       break;
     }
@@ -457,6 +596,7 @@ void TaraxaCapability::interpretCapabilityPacketImpl(NodeID const &_nodeID, unsi
         // vote round >= PBFT round
         db_->saveUnverifiedVote(vote);
         vote_mgr_->addUnverifiedVote(vote);
+        pbft_mgr_->wakeUp();
         packet_stats.is_unique_ = true;
         onNewPbftVote(vote);
       }
@@ -513,6 +653,7 @@ void TaraxaCapability::interpretCapabilityPacketImpl(NodeID const &_nodeID, unsi
       if (pbft_current_round < peer_pbft_round) {
         // Add into votes unverified queue
         vote_mgr_->addUnverifiedVotes(next_votes);
+        pbft_mgr_->wakeUp();
       } else if (pbft_current_round == peer_pbft_round) {
         // Update previous round next votes
         auto pbft_2t_plus_1 = db_->getPbft2TPlus1(pbft_current_round - 1);
@@ -536,6 +677,10 @@ void TaraxaCapability::interpretCapabilityPacketImpl(NodeID const &_nodeID, unsi
       if (my_chain_size >= height_to_sync) {
         blocks_to_transfer =
             std::min((uint64_t)conf_.network_sync_level_size, (uint64_t)(my_chain_size - (height_to_sync - 1)));
+        // Requested number of blocks is optional
+        if (_r.itemCount() > 1) {
+          blocks_to_transfer = std::min(blocks_to_transfer, _r[1].toInt<size_t>());
+        }
       }
 
       LOG(log_dg_pbft_sync_) << "Will send " << blocks_to_transfer << " PBFT blocks to " << _nodeID;
@@ -568,6 +713,9 @@ void TaraxaCapability::interpretCapabilityPacketImpl(NodeID const &_nodeID, unsi
       if (!pbft_chain_->findUnverifiedPbftBlock(pbft_block->getBlockHash())) {
         packet_stats.is_unique_ = true;
         pbft_chain_->pushUnverifiedPbftBlock(pbft_block);
+        if (pbft_mgr_) {
+          pbft_mgr_->wakeUp();
+        }
         onNewPbftBlock(*pbft_block);
       }
 
@@ -578,126 +726,28 @@ void TaraxaCapability::interpretCapabilityPacketImpl(NodeID const &_nodeID, unsi
       auto pbft_blk_count = _r.itemCount();
       LOG(log_dg_pbft_sync_) << "In PbftBlockPacket received, num pbft blocks: " << pbft_blk_count;
 
-      auto pbft_sync_period = pbft_chain_->pbftSyncingPeriod();
-      for (auto const &pbft_blk_tuple : _r) {
-        PbftBlockCert pbft_blk_and_votes(pbft_blk_tuple[0]);
-        auto pbft_blk_hash = pbft_blk_and_votes.pbft_blk->getBlockHash();
-        peer->markPbftBlockAsKnown(pbft_blk_hash);
-        LOG(log_nf_pbft_sync_) << "Received pbft block: " << pbft_blk_and_votes.pbft_blk->getBlockHash();
-
-        if (pbft_chain_->isKnownPbftBlockForSyncing(pbft_blk_hash)) {
-          // Already have this block...
-          return;
-        } else {
-          blk_hash_t last_local_pbft_blockhash;
-          if (pbft_chain_->pbftSyncedQueueEmpty()) {
-            // Look at the chain...
-            last_local_pbft_blockhash = pbft_chain_->getLastPbftBlockHash();
-          } else {
-            last_local_pbft_blockhash = pbft_chain_->pbftSyncedQueueBack().pbft_blk->getBlockHash();
-          }
-
-          if (last_local_pbft_blockhash != pbft_blk_and_votes.pbft_blk->getPrevBlockHash()) {
-            // This block is out of order...
-            if (_nodeID == peer_syncing_pbft_) {
-              LOG(log_si_pbft_sync_) << "PBFT SYNC ERROR, UNEXPECTED PBFT BLOCK HEIGHT: "
-                                     << pbft_blk_and_votes.pbft_blk->getPeriod()
-                                     << ", has synced period: " << pbft_sync_period
-                                     << ", PBFT chain size: " << pbft_chain_->getPbftChainSize()
-                                     << ", synced queue size : " << pbft_chain_->pbftSyncedQueueSize();
-              syncing_ = false;
-            }
-            return;
-          }
-        }
-
-        if (peer->pbft_chain_size_ < pbft_blk_and_votes.pbft_blk->getPeriod()) {
-          peer->pbft_chain_size_ = pbft_blk_and_votes.pbft_blk->getPeriod();
-        }
-
-        string received_dag_blocks_str;
-        map<uint64_t, map<blk_hash_t, pair<DagBlock, vector<Transaction>>>> dag_blocks_per_level;
-        for (auto const &dag_blk_struct : pbft_blk_tuple[1]) {
-          DagBlock dag_blk(dag_blk_struct[0]);
-          auto const &dag_blk_h = dag_blk.getHash();
-          peer->markBlockAsKnown(dag_blk_h);
-          vector<Transaction> newTransactions;
-          for (auto const &trx_raw : dag_blk_struct[1]) {
-            auto &trx = newTransactions.emplace_back(trx_raw);
-            peer->markTransactionAsKnown(trx.getHash());
-          }
-          received_dag_blocks_str += dag_blk_h.toString() + " ";
-          auto level = dag_blk.getLevel();
-          dag_blocks_per_level[level][dag_blk_h] = {move(dag_blk), move(newTransactions)};
-        }
-        LOG(log_nf_dag_sync_) << "Received Dag Blocks: " << received_dag_blocks_str;
-        for (auto const &block_level : dag_blocks_per_level) {
-          for (auto const &block : block_level.second) {
-            auto status = checkDagBlockValidation(block.second.first);
-            if (!status.first) {
-              if (peer_syncing_pbft_ == _nodeID) {
-                LOG(log_si_pbft_sync_) << "PBFT SYNC ERROR, DAG missing a tip/pivot in period "
-                                       << pbft_blk_and_votes.pbft_blk->getPeriod()
-                                       << ", has synced period: " << pbft_sync_period
-                                       << ", PBFT chain size: " << pbft_chain_->getPbftChainSize()
-                                       << ", synced queue size: " << pbft_chain_->pbftSyncedQueueSize();
-                syncing_ = false;
-              }
-              return;
-            }
-            LOG(log_nf_dag_sync_) << "Storing DAG block " << block.second.first.getHash().toString() << " with "
-                                  << block.second.second.size() << " transactions";
-            if (block.second.first.getLevel() > peer->dag_level_) {
-              peer->dag_level_ = block.second.first.getLevel();
-            }
-            dag_blk_mgr_->insertBroadcastedBlockWithTransactions(block.second.first, block.second.second);
-          }
-        }
-
-        // Check the PBFT block whether in the chain or in the synced queue
-        if (!pbft_chain_->isKnownPbftBlockForSyncing(pbft_blk_hash)) {
-          // Check the PBFT block validation
-          if (pbft_chain_->checkPbftBlockValidationFromSyncing(*pbft_blk_and_votes.pbft_blk)) {
-            // Notice: cannot verify 2t+1 cert votes here. Since don't
-            // have correct account status for nodes which after the
-            // first synced one.
-            pbft_chain_->setSyncedPbftBlockIntoQueue(pbft_blk_and_votes);
-            pbft_sync_period = pbft_chain_->pbftSyncingPeriod();
-            LOG(log_nf_pbft_sync_) << "Synced PBFT block hash " << pbft_blk_hash << " with "
-                                   << pbft_blk_and_votes.cert_votes.size() << " cert votes";
-            LOG(log_dg_pbft_sync_) << "Synced PBFT block " << pbft_blk_and_votes;
-          } else {
-            LOG(log_er_pbft_sync_) << "The PBFT block " << pbft_blk_hash << " failed validation. Drop it!";
-          }
-        }
+      // Period of the first block, <PbftBlockCert <PbftBlock ...> ...>
+      auto const first_period = pbft_blk_count ? _r[0][0][0][2].toInt<uint64_t>() : 0;
+      auto request = pbft_sync_scheduler_.onResponse(_nodeID, pbft_blk_count, first_period, _r.data().toBytes());
+      if (!request) {
+        LOG(log_dg_pbft_sync_) << "Drop PbftBlockPacket from " << _nodeID
+                               << ", its request is timed out or the packet starts at period " << first_period;
+        syncPeersPbft();
+        break;
       }
-
-      if (pbft_blk_count > 0) {
-        if (syncing_) {
-          if (pbft_sync_period > pbft_chain_->getPbftChainSize() + (10 * conf_.network_sync_level_size)) {
-            LOG(log_dg_pbft_sync_) << "Syncing pbft blocks too fast than processing. Has synced period "
-                                   << pbft_sync_period << ", PBFT chain size " << pbft_chain_->getPbftChainSize();
-            tp_.post(1000, [this, _nodeID] { delayedPbftSync(_nodeID, 1); });
-          } else {
-            syncPeerPbft(_nodeID, pbft_sync_period + 1);
-          }
-        }
-      } else {
-        LOG(log_dg_pbft_sync_) << "Syncing PBFT is completed";
-        // We are pbft synced with the node we are connected to but
-        // calling restartSyncingPbft will check if some nodes have
-        // greater pbft chain size and we should continue syncing with
-        // them, Or sync pending DAG blocks
-        restartSyncingPbft(true);
-        // We are pbft synced, send message to other node to start
-        // gossiping new blocks
-        if (!syncing_) {
-          // TODO: Why need to clear all DAG blocks and transactions?
-          // This is inside PbftBlockPacket. Why don't clear PBFT blocks and votes?
-          sendSyncedMessage();
+      if (pbft_blk_count < request->count) {
+        // Peer doesn't have the rest of requested blocks
+        peer->pbft_chain_size_ = request->from + pbft_blk_count - 1;
+      }
+      // Cert votes are checked on vote manager pool while blocks wait for the ranges before them. Only vote fields are
+      // decoded here, VRF proofs and signatures are verified on the pool. Hash of the block is the hash of its RLP
+      if (vote_mgr_) {
+        for (auto const &pbft_blk_tuple : _r) {
+          auto const &cert_rlp = pbft_blk_tuple[0];
+          vote_mgr_->verifyVotesCryptoAsync(decodeCertVotes(dev::sha3(cert_rlp[0].data()), cert_rlp[1], false));
         }
       }
-
+      syncPeersPbft();
       break;
     }
     case TestPacket: {
@@ -723,11 +773,109 @@ void TaraxaCapability::handle_read_exception(weak_ptr<Session> session, unsigned
   }
 }
 
-void TaraxaCapability::delayedPbftSync(NodeID _nodeID, int counter) {
+bool TaraxaCapability::processSyncedPbftBlocks_(NodeID const &_nodeID, RLP const &_r) {
+  auto peer = getPeer(_nodeID);
+  if (!peer) {
+    // Peer has disconnected after it sent the blocks, they are still good
+    peer = std::make_shared<TaraxaPeer>(_nodeID);
+  }
+  auto pbft_sync_period = pbft_chain_->pbftSyncingPeriod();
+  for (auto const &pbft_blk_tuple : _r) {
+    PbftBlockCert pbft_blk_and_votes(pbft_blk_tuple[0]);
+    auto pbft_blk_hash = pbft_blk_and_votes.pbft_blk->getBlockHash();
+    peer->markPbftBlockAsKnown(pbft_blk_hash);
+    LOG(log_nf_pbft_sync_) << "Received pbft block: " << pbft_blk_and_votes.pbft_blk->getBlockHash();
+
+    if (pbft_chain_->isKnownPbftBlockForSyncing(pbft_blk_hash)) {
+      // Already have this block...
+      continue;
+    } else {
+      blk_hash_t last_local_pbft_blockhash;
+      if (pbft_chain_->pbftSyncedQueueEmpty()) {
+        // Look at the chain...
+        last_local_pbft_blockhash = pbft_chain_->getLastPbftBlockHash();
+      } else {
+        last_local_pbft_blockhash = pbft_chain_->pbftSyncedQueueBack().pbft_blk->getBlockHash();
+      }
+
+      if (last_local_pbft_blockhash != pbft_blk_and_votes.pbft_blk->getPrevBlockHash()) {
+        // This block is out of order...
+        LOG(log_si_pbft_sync_) << "PBFT SYNC ERROR, UNEXPECTED PBFT BLOCK HEIGHT: "
+                               << pbft_blk_and_votes.pbft_blk->getPeriod() << " from " << _nodeID
+                               << ", has synced period: " << pbft_sync_period
+                               << ", PBFT chain size: " << pbft_chain_->getPbftChainSize()
+                               << ", synced queue size : " << pbft_chain_->pbftSyncedQueueSize();
+        return false;
+      }
+    }
+
+    if (peer->pbft_chain_size_ < pbft_blk_and_votes.pbft_blk->getPeriod()) {
+      peer->pbft_chain_size_ = pbft_blk_and_votes.pbft_blk->getPeriod();
+    }
+
+    string received_dag_blocks_str;
+    map<uint64_t, map<blk_hash_t, pair<DagBlock, vector<Transaction>>>> dag_blocks_per_level;
+    for (auto const &dag_blk_struct : pbft_blk_tuple[1]) {
+      DagBlock dag_blk(dag_blk_struct[0]);
+      auto const &dag_blk_h = dag_blk.getHash();
+      peer->markBlockAsKnown(dag_blk_h);
+      vector<Transaction> newTransactions;
+      for (auto const &trx_raw : dag_blk_struct[1]) {
+        auto &trx = newTransactions.emplace_back(trx_raw);
+        peer->markTransactionAsKnown(trx.getHash());
+      }
+      received_dag_blocks_str += dag_blk_h.toString() + " ";
+      auto level = dag_blk.getLevel();
+      dag_blocks_per_level[level][dag_blk_h] = {move(dag_blk), move(newTransactions)};
+    }
+    LOG(log_nf_dag_sync_) << "Received Dag Blocks: " << received_dag_blocks_str;
+    for (auto const &block_level : dag_blocks_per_level) {
+      for (auto const &block : block_level.second) {
+        auto status = checkDagBlockValidation(block.second.first);
+        if (!status.first) {
+          LOG(log_si_pbft_sync_) << "PBFT SYNC ERROR, DAG missing a tip/pivot in period "
+                                 << pbft_blk_and_votes.pbft_blk->getPeriod() << " from " << _nodeID
+                                 << ", has synced period: " << pbft_sync_period
+                                 << ", PBFT chain size: " << pbft_chain_->getPbftChainSize()
+                                 << ", synced queue size: " << pbft_chain_->pbftSyncedQueueSize();
+          return false;
+        }
+        LOG(log_nf_dag_sync_) << "Storing DAG block " << block.second.first.getHash().toString() << " with "
+                              << block.second.second.size() << " transactions";
+        if (block.second.first.getLevel() > peer->dag_level_) {
+          peer->dag_level_ = block.second.first.getLevel();
+        }
+        dag_blk_mgr_->insertBroadcastedBlockWithTransactions(block.second.first, block.second.second);
+      }
+    }
+
+    // Check the PBFT block whether in the chain or in the synced queue
+    if (!pbft_chain_->isKnownPbftBlockForSyncing(pbft_blk_hash)) {
+      // Check the PBFT block validation
+      if (pbft_chain_->checkPbftBlockValidationFromSyncing(*pbft_blk_and_votes.pbft_blk)) {
+        // Notice: cannot verify 2t+1 cert votes here. Since don't
+        // have correct account status for nodes which after the
+        // first synced one.
+        pbft_chain_->setSyncedPbftBlockIntoQueue(pbft_blk_and_votes);
+        pbft_sync_period = pbft_chain_->pbftSyncingPeriod();
+        LOG(log_nf_pbft_sync_) << "Synced PBFT block hash " << pbft_blk_hash << " with "
+                               << pbft_blk_and_votes.cert_votes.size() << " cert votes";
+        LOG(log_dg_pbft_sync_) << "Synced PBFT block " << pbft_blk_and_votes;
+      } else {
+        LOG(log_er_pbft_sync_) << "The PBFT block " << pbft_blk_hash << " failed validation. Drop it!";
+      }
+    }
+  }
+  return true;
+}
+
+void TaraxaCapability::delayedPbftSync(int counter) {
   auto pbft_sync_period = pbft_chain_->pbftSyncingPeriod();
   if (counter > 60) {
     LOG(log_er_pbft_sync_) << "Pbft blocks stuck in queue, no new block processed in 60 seconds " << pbft_sync_period
                            << " " << pbft_chain_->getPbftChainSize();
+    pbft_sync_delayed_ = false;
+    pbft_sync_scheduler_.stop();
     syncing_ = false;
     LOG(log_dg_pbft_sync_) << "Syncing PBFT is stopping";
     return;
@@ -737,10 +885,13 @@ void TaraxaCapability::delayedPbftSync(NodeID _nodeID, int counter) {
     if (pbft_sync_period > pbft_chain_->getPbftChainSize() + (10 * conf_.network_sync_level_size)) {
       LOG(log_dg_pbft_sync_) << "Syncing pbft blocks faster than processing " << pbft_sync_period << " "
                              << pbft_chain_->getPbftChainSize();
-      tp_.post(1000, [this, _nodeID, counter] { delayedPbftSync(_nodeID, counter + 1); });
-    } else {
-      syncPeerPbft(_nodeID, pbft_sync_period + 1);
+      tp_.post(1000, [this, counter] { delayedPbftSync(counter + 1); });
+      return;
     }
+    pbft_sync_delayed_ = false;
+    syncPeersPbft();
+  } else {
+    pbft_sync_delayed_ = false;
   }
 }
 
@@ -772,15 +923,18 @@ void TaraxaCapability::restartSyncingPbft(bool force) {
     LOG(log_si_pbft_sync_) << "Restarting syncing PBFT from peer " << max_pbft_chain_nodeID << ", peer PBFT chain size "
                            << max_pbft_chain_size << ", own PBFT chain synced at period " << pbft_sync_period;
     requesting_pending_dag_blocks_ = false;
-    // TODO: When set sycning to false if never get peer response?
     syncing_ = true;
-    peer_syncing_pbft_ = max_pbft_chain_nodeID;
-    syncPeerPbft(peer_syncing_pbft_, pbft_sync_period + 1);
+    // Sync in progress keeps its requests and buffered ranges, new peer chain sizes are used by the next schedule
+    if (!pbft_sync_scheduler_.active()) {
+      pbft_sync_scheduler_.start(pbft_sync_period);
+    }
+    syncPeersPbft();
   } else {
     LOG(log_nf_pbft_sync_) << "Restarting syncing PBFT not needed since our pbft chain size: " << pbft_sync_period
                            << "(" << pbft_chain_->getPbftChainSize() << ")"
                            << " is greater or equal than max node pbft chain size:" << max_pbft_chain_size;
     syncing_ = false;
+    pbft_sync_scheduler_.stop();
     if (force || (!requesting_pending_dag_blocks_ &&
                   max_node_dag_level > std::max(dag_mgr_->getMaxLevel(), dag_blk_mgr_->getMaxDagLevelInQueue()))) {
       LOG(log_nf_dag_sync_) << "Request pending " << max_node_dag_level << " "
@@ -799,9 +953,10 @@ void TaraxaCapability::onDisconnect(NodeID const &_nodeID) {
     cnt_received_messages_.erase(_nodeID);
     test_sums_.erase(_nodeID);
     erasePeer(_nodeID);
-    if (syncing_ && peer_syncing_pbft_ == _nodeID && getPeersCount() > 0) {
-      LOG(log_dg_pbft_sync_) << "Syncing PBFT is stopping";
-      restartSyncingPbft(true);
+    if (syncing_) {
+      // Range requested from the peer goes to other peers
+      pbft_sync_scheduler_.onPeerDisconnected(_nodeID);
+      syncPeersPbft();
     } else if (requesting_pending_dag_blocks_ && requesting_pending_dag_blocks_node_id_ == _nodeID) {
       requesting_pending_dag_blocks_ = false;
       restartSyncingPbft(true);
@@ -879,16 +1034,12 @@ std::pair<std::vector<NodeID>, std::vector<NodeID>> TaraxaCapability::randomPart
   return std::make_pair(move(part1), move(part2));
 }
 
-void TaraxaCapability::onNewTransactions(std::vector<taraxa::bytes> const &transactions, bool fromNetwork) {
+void TaraxaCapability::onNewTransactions(std::vector<Transaction> const &transactions, bool fromNetwork) {
   if (fromNetwork) {
-    if (dag_blk_mgr_) {
-      LOG(log_nf_trx_prp_) << "Storing " << transactions.size() << " transactions";
-      received_trx_count += transactions.size();
-      unique_received_trx_count += trx_mgr_->insertBroadcastedTransactions(transactions);
-    } else {
-      for (auto const &transaction : transactions) {
-        Transaction trx(transaction);
-        auto trx_hash = trx.getHash();
+    // Broadcasted transactions are inserted by transaction manager before they get here, only test ones are stored
+    if (!dag_blk_mgr_) {
+      for (auto const &trx : transactions) {
+        auto const &trx_hash = trx.getHash();
         if (test_transactions_.find(trx_hash) == test_transactions_.end()) {
           test_transactions_[trx_hash] = trx;
           LOG(log_dg_trx_prp_) << "Received New Transaction " << trx_hash;
@@ -899,30 +1050,70 @@ void TaraxaCapability::onNewTransactions(std::vector<taraxa::bytes> const &trans
     }
   }
   if (!fromNetwork || conf_.network_transaction_interval == 0) {
-    std::map<NodeID, std::vector<taraxa::bytes>> transactionsToSend;
-    std::map<NodeID, std::vector<trx_hash_t>> transactionsHashToSend;
+    // Transactions come decoded, hashes are cached inside of them
+    vec_trx_t hashes;
+    hashes.reserve(transactions.size());
+    for (auto const &transaction : transactions) {
+      hashes.push_back(transaction.getHash());
+    }
+
+    std::vector<NodeID> peersWithoutTransactions;
+    std::unordered_map<NodeID, std::vector<size_t>> unknownTransactions;
     {
       boost::shared_lock<boost::shared_mutex> lock(peers_mutex_);
       for (auto &peer : peers_) {
-        if (!peer.second->syncing_) {
-          for (auto const &transaction : transactions) {
-            Transaction trx(transaction);
-            auto trx_hash = trx.getHash();
-            if (!peer.second->isTransactionKnown(trx_hash)) {
-              transactionsToSend[peer.first].push_back(transaction);
-              transactionsHashToSend[peer.first].push_back(trx_hash);
-            }
+        if (peer.second->syncing_) {
+          continue;
+        }
+        std::vector<size_t> unknown;
+        for (size_t idx = 0; idx < hashes.size(); idx++) {
+          if (!peer.second->isTransactionKnown(hashes[idx])) {
+            unknown.push_back(idx);
           }
         }
+        if (!unknown.empty()) {
+          peersWithoutTransactions.push_back(peer.first);
+          unknownTransactions.emplace(peer.first, std::move(unknown));
+        }
       }
     }
-    for (auto &it : transactionsToSend) {
-      sendTransactions(it.first, it.second);
+
+    // Full transactions are pushed only to a small random subset of peers, the rest receive hashes and request
+    // the transactions they miss
+    auto const peersToSendNumber = std::min<std::size_t>(
+        std::max<std::size_t>(conf_.network_min_transaction_broadcast, std::sqrt(peersWithoutTransactions.size())),
+        conf_.network_max_transaction_broadcast);
+
+    std::vector<NodeID> peersToSend;
+    std::vector<NodeID> peersToAnnounce;
+    std::tie(peersToSend, peersToAnnounce) = randomPartitionPeers(peersWithoutTransactions, peersToSendNumber);
+
+    // Each transaction is encoded at most once for all peers it is sent to
+    std::vector<std::shared_ptr<taraxa::bytes>> rlps(transactions.size());
+    for (auto const &peerID : peersToSend) {
+      std::vector<taraxa::bytes> transactionsToSend;
+      for (auto idx : unknownTransactions[peerID]) {
+        if (!rlps[idx]) {
+          rlps[idx] = transactions[idx].rlp();
+        }
+        transactionsToSend.push_back(*rlps[idx]);
+      }
+      sendTransactions(peerID, transactionsToSend);
+    }
+    for (auto const &peerID : peersToAnnounce) {
+      vec_trx_t hashesToSend;
+      for (auto idx : unknownTransactions[peerID]) {
+        hashesToSend.push_back(hashes[idx]);
+      }
+      sendTransactionHashes(peerID, hashesToSend);
     }
+
     boost::unique_lock<boost::shared_mutex> lock(peers_mutex_);
-    for (auto &it : transactionsHashToSend) {
-      for (auto &it2 : it.second) {
-        peers_[it.first]->markTransactionAsKnown(it2);
+    for (auto const &[peerID, unknown] : unknownTransactions) {
+      if (auto peer = peers_.find(peerID); peer != peers_.end()) {
+        for (auto idx : unknown) {
+          peer->second->markTransactionAsKnown(hashes[idx]);
+        }
       }
     }
   }
@@ -1033,6 +1224,27 @@ void TaraxaCapability::sendTransactions(NodeID const &_id, std::vector<taraxa::b
   sealAndSend(_id, TransactionPacket, move(s));
 }
 
+void TaraxaCapability::sendTransactionHashes(NodeID const &_id, vec_trx_t const &hashes) {
+  LOG(log_nf_trx_prp_) << "sendTransactionHashes " << hashes.size() << " to " << _id;
+  RLPStream s(hashes.size());
+  for (auto const &hash : hashes) {
+    s << hash;
+  }
+  sealAndSend(_id, NewTransactionHashesPacket, move(s));
+}
+
+void TaraxaCapability::requestTransactions(NodeID const &_id, vec_trx_t const &hashes) {
+  LOG(log_nf_trx_prp_) << "requestTransactions " << hashes.size() << " from " << _id;
+  for (size_t begin = 0; begin < hashes.size(); begin += c_max_transactions_in_request) {
+    auto const end = std::min(hashes.size(), begin + c_max_transactions_in_request);
+    RLPStream s(end - begin);
+    for (auto idx = begin; idx < end; idx++) {
+      s << hashes[idx];
+    }
+    sealAndSend(_id, GetTransactionsPacket, move(s));
+  }
+}
+
 void TaraxaCapability::sendBlock(NodeID const &_id, taraxa::DagBlock block) {
   vec_trx_t transactionsToSend;
   for (auto trx : block.getTrxs()) {
@@ -1071,9 +1283,10 @@ void TaraxaCapability::requestBlock(NodeID const &_id, blk_hash_t hash) {
   sealAndSend(_id, GetNewBlockPacket, RLPStream(1) << hash);
 }
 
-void TaraxaCapability::requestPbftBlocks(NodeID const &_id, size_t height_to_sync) {
-  LOG(log_dg_pbft_sync_) << "Sending GetPbftBlockPacket with height: " << height_to_sync;
-  sealAndSend(_id, GetPbftBlockPacket, RLPStream(1) << height_to_sync);
+void TaraxaCapability::requestPbftBlocks(NodeID const &_id, size_t height_to_sync, size_t blocks_to_transfer) {
+  LOG(log_dg_pbft_sync_) << "Sending GetPbftBlockPacket with height: " << height_to_sync << ", blocks "
+                         << blocks_to_transfer;
+  sealAndSend(_id, GetPbftBlockPacket, RLPStream(2) << height_to_sync << blocks_to_transfer);
 }
 
 void TaraxaCapability::requestPendingDagBlocks(NodeID const &_id) {
@@ -1099,7 +1312,7 @@ std::map<trx_hash_t, taraxa::Transaction> TaraxaCapability::getTransactions() {
 
 void TaraxaCapability::sendTransactions() {
   if (trx_mgr_) {
-    onNewTransactions(trx_mgr_->getNewVerifiedTrxSnapShotSerialized(), false);
+    onNewTransactions(trx_mgr_->getNewVerifiedTrxSnapShot(), false);
     tp_.post(conf_.network_transaction_interval, [this] { sendTransactions(); });
   }
 }
@@ -1121,6 +1334,16 @@ void TaraxaCapability::doBackgroundWork() {
     }
   }
 
+  // Forget timed out transaction requests, announced transactions are requested again
+  auto const now = getCurrentTimeMilliSeconds();
+  for (auto it = requested_transactions_.begin(); it != requested_transactions_.end();) {
+    if (now - it->second > c_transaction_request_timeout_ms) {
+      it = requested_transactions_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
   tp_.post(check_status_interval_, [this] { doBackgroundWork(); });
 }
 
@@ -1219,7 +1442,7 @@ void TaraxaCapability::logNodeStats() {
     auto percent_synced = (local_pbft_sync_period * 100) / peer_max_pbft_chain_size;
     auto syncing_time_sec = summary_interval_ms_ * syncing_interval_count_ / 1000;
     LOG(log_nf_summary_) << "Syncing for " << syncing_time_sec << " seconds, " << percent_synced << "% synced";
-    LOG(log_nf_summary_) << "Currently syncing from node " << peer_syncing_pbft_;
+    LOG(log_nf_summary_) << "Currently syncing from " << pbft_sync_scheduler_.inFlight() << " nodes";
     LOG(log_nf_summary_) << "Max peer PBFT chain size:      " << peer_max_pbft_chain_size << " (peer "
                          << max_pbft_chain_nodeID << ")";
     LOG(log_nf_summary_) << "Max peer PBFT consensus round: " << peer_max_pbft_round << " (peer "
@@ -1593,6 +1816,10 @@ string TaraxaCapability::packetTypeToString(unsigned int packet) const {
       return "SyncedPacket";
     case SyncedResponsePacket:
       return "SyncedResponsePacket";
+    case NewTransactionHashesPacket:
+      return "NewTransactionHashesPacket";
+    case GetTransactionsPacket:
+      return "GetTransactionsPacket";
   }
   return "unknown packet type: " + std::to_string(packet);
 }
@@ -13,7 +13,9 @@
 #include "consensus/vote.hpp"
 #include "dag/dag_block_manager.hpp"
 #include "packets_stats.hpp"
+#include "pbft_sync_scheduler.hpp"
 #include "transaction_manager/transaction.hpp"
+#include "util/rolling_bloom_filter.hpp"
 #include "util/thread_pool.hpp"
 #include "util/util.hpp"
 
@@ -40,6 +42,8 @@ enum SubprotocolPacketType : ::byte {
   PbftBlockPacket,
   SyncedPacket,
   SyncedResponsePacket,
+  NewTransactionHashesPacket,
+  GetTransactionsPacket,
   PacketCount
 };
 
@@ -49,22 +53,13 @@ struct InvalidDataException : public std::runtime_error {
 
 class TaraxaPeer : public boost::noncopyable {
  public:
-  TaraxaPeer()
-      : known_blocks_(10000, 1000),
-        known_transactions_(100000, 10000),
-        known_pbft_blocks_(10000, 1000),
-        known_votes_(10000, 1000) {}
-  explicit TaraxaPeer(NodeID id)
-      : m_id(id),
-        known_blocks_(10000, 1000),
-        known_transactions_(100000, 10000),
-        known_pbft_blocks_(10000, 1000),
-        known_votes_(10000, 1000) {}
-
-  bool isBlockKnown(blk_hash_t const &_hash) const { return known_blocks_.count(_hash); }
+  TaraxaPeer() = default;
+  explicit TaraxaPeer(NodeID id) : m_id(id) {}
+
+  bool isBlockKnown(blk_hash_t const &_hash) const { return known_blocks_.contains(_hash); }
   void markBlockAsKnown(blk_hash_t const &_hash) { known_blocks_.insert(_hash); }
 
-  bool isTransactionKnown(trx_hash_t const &_hash) const { return known_transactions_.count(_hash); }
+  bool isTransactionKnown(trx_hash_t const &_hash) const { return known_transactions_.contains(_hash); }
   void markTransactionAsKnown(trx_hash_t const &_hash) { known_transactions_.insert(_hash); }
 
   void clearAllKnownBlocksAndTransactions() {
@@ -73,10 +68,10 @@ class TaraxaPeer : public boost::noncopyable {
   }
 
   // PBFT
-  bool isVoteKnown(vote_hash_t const &_hash) const { return known_votes_.count(_hash); }
+  bool isVoteKnown(vote_hash_t const &_hash) const { return known_votes_.contains(_hash); }
   void markVoteAsKnown(vote_hash_t const &_hash) { known_votes_.insert(_hash); }
 
-  bool isPbftBlockKnown(blk_hash_t const &_hash) const { return known_pbft_blocks_.count(_hash); }
+  bool isPbftBlockKnown(blk_hash_t const &_hash) const { return known_pbft_blocks_.contains(_hash); }
   void markPbftBlockAsKnown(blk_hash_t const &_hash) { known_pbft_blocks_.insert(_hash); }
 
   bool checkStatus(uint16_t max_check_count) {
@@ -96,11 +91,17 @@ class TaraxaPeer : public boost::noncopyable {
  private:
   NodeID m_id;
 
-  ExpirationCache<blk_hash_t> known_blocks_;
-  ExpirationCache<trx_hash_t> known_transactions_;
+  // False positive means that item is not sent to the peer, it still gets it from other peers. Transactions are
+  // cheaper to miss than blocks and votes
+  static constexpr double c_known_transactions_fp_rate = 0.001;
+  static constexpr double c_known_fp_rate = 0.0001;
+  static constexpr std::chrono::minutes c_known_generation_lifetime{5};
+
+  util::RollingBloomFilter known_blocks_{10000, c_known_fp_rate, c_known_generation_lifetime};
+  util::RollingBloomFilter known_transactions_{100000, c_known_transactions_fp_rate, c_known_generation_lifetime};
   // PBFT
-  ExpirationCache<blk_hash_t> known_pbft_blocks_;
-  ExpirationCache<vote_hash_t> known_votes_;  // for peers
+  util::RollingBloomFilter known_pbft_blocks_{10000, c_known_fp_rate, c_known_generation_lifetime};
+  util::RollingBloomFilter known_votes_{10000, c_known_fp_rate, c_known_generation_lifetime};  // for peers
 
   uint16_t status_check_count_ = 0;
 };
@@ -129,16 +130,18 @@ struct TaraxaCapability : virtual CapabilityFace {
   void sealAndSend(NodeID const &nodeID, unsigned packet_type, RLPStream rlp);
   bool pbft_syncing() const { return syncing_.load(); }
 
-  void syncPeerPbft(NodeID const &_nodeID, unsigned long height_to_sync);
+  void syncPeersPbft();
   void restartSyncingPbft(bool force = false);
-  void delayedPbftSync(NodeID _nodeID, int counter);
+  // For callers outside of the network thread
+  void restartSyncingPbftAsync(bool force = false) { tp_.post([this, force] { restartSyncingPbft(force); }); }
+  void delayedPbftSync(int counter);
   std::pair<bool, blk_hash_t> checkDagBlockValidation(DagBlock const &block);
   void interpretCapabilityPacketImpl(NodeID const &_nodeID, unsigned _id, RLP const &_r, PacketStats &packet_stats);
   void sendTestMessage(NodeID const &_id, int _x);
   void sendStatus(NodeID const &_id, bool _initial);
   void onNewBlockReceived(DagBlock block, std::vector<Transaction> transactions);
   void onNewBlockVerified(DagBlock const &block);
-  void onNewTransactions(std::vector<taraxa::bytes> const &transactions, bool fromNetwork);
+  void onNewTransactions(std::vector<Transaction> const &transactions, bool fromNetwork);
   vector<NodeID> selectPeers(std::function<bool(TaraxaPeer const &)> const &_predicate);
   vector<NodeID> getAllPeers() const;
   Json::Value getStatus() const;
@@ -152,6 +155,8 @@ struct TaraxaCapability : virtual CapabilityFace {
   void requestBlock(NodeID const &_id, blk_hash_t hash);
   void requestPendingDagBlocks(NodeID const &_id);
   void sendTransactions(NodeID const &_id, std::vector<taraxa::bytes> const &transactions);
+  void sendTransactionHashes(NodeID const &_id, vec_trx_t const &hashes);
+  void requestTransactions(NodeID const &_id, vec_trx_t const &hashes);
 
   std::map<blk_hash_t, taraxa::DagBlock> getBlocks();
   std::map<trx_hash_t, taraxa::Transaction> getTransactions();
@@ -169,7 +174,7 @@ struct TaraxaCapability : virtual CapabilityFace {
   void sendPbftVote(NodeID const &_id, taraxa::Vote const &vote);
   void onNewPbftBlock(taraxa::PbftBlock const &pbft_block);
   void sendPbftBlock(NodeID const &_id, taraxa::PbftBlock const &pbft_block, uint64_t const &pbft_chain_size);
-  void requestPbftBlocks(NodeID const &_id, size_t height_to_sync);
+  void requestPbftBlocks(NodeID const &_id, size_t height_to_sync, size_t blocks_to_transfer);
   void sendPbftBlocks(NodeID const &_id, size_t height_to_sync, size_t blocks_to_transfer);
   void syncPbftNextVotes(uint64_t const pbft_round, size_t const pbft_previous_round_next_votes_size);
   void requestPbftNextVotes(NodeID const &peerID, uint64_t const pbft_round,
@@ -185,12 +190,15 @@ struct TaraxaCapability : virtual CapabilityFace {
 
  private:
   void handle_read_exception(weak_ptr<Session> session, unsigned _id, RLP const &_r);
+  // Returns false if the blocks don't follow the synced ones
+  bool processSyncedPbftBlocks_(NodeID const &_nodeID, RLP const &_r);
 
   weak_ptr<Host> host_;
   NodeID node_id_;
   util::ThreadPool tp_{1, false};
 
   atomic<bool> syncing_ = false;
+  bool pbft_sync_delayed_ = false;
   bool requesting_pending_dag_blocks_ = false;
   NodeID requesting_pending_dag_blocks_node_id_;
 
@@ -202,6 +210,12 @@ struct TaraxaCapability : virtual CapabilityFace {
   std::map<trx_hash_t, Transaction> test_transactions_;
 
   std::set<blk_hash_t> block_requestes_set_;
+  // Announced transactions requested from peers -> request time, they are requested again after timeout
+  std::unordered_map<trx_hash_t, uint64_t> requested_transactions_;
+  static constexpr uint64_t c_transaction_request_timeout_ms = 2000;
+  // Max number of transactions requested in one GetTransactionsPacket
+  static constexpr size_t c_max_transactions_in_request = 1024;
+  static constexpr uint64_t c_pbft_sync_request_timeout_ms = 10000;
 
   std::shared_ptr<DbStorage> db_;
   std::shared_ptr<PbftManager> pbft_mgr_;
@@ -217,7 +231,7 @@ struct TaraxaCapability : virtual CapabilityFace {
   mutable boost::shared_mutex peers_mutex_;
   NetworkConfig conf_;
   uint64_t dag_level_ = 0;
-  NodeID peer_syncing_pbft_;
+  PbftSyncScheduler pbft_sync_scheduler_;
   std::string genesis_;
   bool performance_log_;
   mutable std::mt19937_64 urng_;  // Mersenne Twister psuedo-random number generator
@@ -226,7 +240,8 @@ struct TaraxaCapability : virtual CapabilityFace {
   uint16_t check_status_interval_ = 0;
 
   uint64_t received_trx_count = 0;
-  uint64_t unique_received_trx_count = 0;
+  // Updated by transaction manager verification pool
+  std::atomic<uint64_t> unique_received_trx_count = 0;
 
   // Node stats info history
   uint64_t summary_interval_ms_ = 30000;
@@ -1,5 +1,7 @@
 #include "executor.hpp"
 
+#include <algorithm>
+
 #include "config/config.hpp"
 
 namespace taraxa {
@@ -13,7 +15,7 @@ struct ReplayProtectionServiceDummy : ReplayProtectionService {
 Executor::Executor(addr_t node_addr, std::shared_ptr<DbStorage> db, std::shared_ptr<DagManager> dag_mgr,
                    std::shared_ptr<TransactionManager> trx_mgr, std::shared_ptr<DagBlockManager> dag_blk_mgr,
                    std::shared_ptr<FinalChain> final_chain, std::shared_ptr<PbftChain> pbft_chain,
-                   uint32_t expected_max_trx_per_block)
+                   uint32_t expected_max_trx_per_block, ExecutorConfig const &config)
     : replay_protection_service_(new ReplayProtectionServiceDummy),
       db_(db),
       dag_mgr_(dag_mgr),
@@ -21,14 +23,18 @@ Executor::Executor(addr_t node_addr, std::shared_ptr<DbStorage> db, std::shared_
       dag_blk_mgr_(dag_blk_mgr),
       final_chain_(final_chain),
       pbft_chain_(pbft_chain),
-      node_addr_(node_addr) {
+      node_addr_(node_addr),
+      period_execution_(db_, db_, final_chain_, sender_recovery_pool_, expected_max_trx_per_block),
+      sync_each_n_periods_(config.sync_each_n_periods),
+      sync_interval_(config.sync_interval_ms) {
   LOG_OBJECTS_CREATE("EXECUTOR");
-  if (auto last_period = pbft_chain_->getPbftChainSize(); final_chain_->last_block_number() < last_period) {
+  committed_period_ = final_chain_->last_block_number();
+  next_to_prepare_ = committed_period_ + 1;
+  if (auto last_period = pbft_chain_->getPbftChainSize(); committed_period_ < last_period) {
     to_execute_ = load_pbft_blk(last_period);
   }
   num_executed_dag_blk_ = db_->getStatusField(taraxa::StatusDbField::ExecutedBlkCount);
   num_executed_trx_ = db_->getStatusField(taraxa::StatusDbField::ExecutedTrxCount);
-  transactions_tmp_buf_.reserve(expected_max_trx_per_block);
 }
 
 Executor::~Executor() { stop(); }
@@ -40,6 +46,17 @@ void Executor::start() {
     return;
   }
   LOG(log_nf_) << "Executor start...";
+  // Periods committed without sync might be lost on OS crash, state db is checkpointed at synced periods to be
+  // restored from when it gets ahead of main db. The first checkpoint is taken at the current period
+  if (sync_each_n_periods_ != 1) {
+    syncPeriods_();
+  }
+  sender_recovery_pool_.start();
+  prefetch_worker_ = std::make_unique<std::thread>([this]() {
+    while (!stopped_) {
+      prefetchTick();
+    }
+  });
   exec_worker_ = std::make_unique<std::thread>([this]() {
     LOG(log_nf_) << "Executor run...";
     while (!stopped_) {
@@ -52,8 +69,17 @@ void Executor::stop() {
   if (bool b = false; !stopped_.compare_exchange_strong(b, !b)) {
     return;
   }
-  cv_.notify_one();
+  {
+    std::unique_lock l(mu_);
+    cv_.notify_one();
+    prefetch_cv_.notify_one();
+  }
   exec_worker_->join();
+  prefetch_worker_->join();
+  if (unsynced_periods_) {
+    syncPeriods_();
+  }
+  sender_recovery_pool_.stop();
   LOG(log_nf_) << "Executor stopped";
 }
 
@@ -66,74 +92,117 @@ void Executor::execute(std::shared_ptr<PbftBlock> blk) {
     }
     to_execute_ = move(blk);
   }
+  prefetch_cv_.notify_one();
+}
+
+void Executor::prefetchTick() {
+  std::shared_ptr<PbftBlock> pbft_block;
+  {
+    std::unique_lock l(mu_);
+    prefetch_cv_.wait(l, [this] {
+      return stopped_ || (to_execute_ && next_to_prepare_ <= to_execute_->getPeriod() &&
+                          prepared_.size() < c_max_prefetched_periods);
+    });
+    if (stopped_) {
+      return;
+    }
+    // Target block might not be in db yet, periods before it are
+    if (next_to_prepare_ == to_execute_->getPeriod()) {
+      pbft_block = to_execute_;
+    }
+  }
+  if (!pbft_block) {
+    pbft_block = load_pbft_blk(next_to_prepare_);
+  }
+
+  auto prepared = prepare_(move(pbft_block));
+  {
+    std::unique_lock l(mu_);
+    prepared_.push_back(move(prepared));
+    ++next_to_prepare_;
+  }
   cv_.notify_one();
 }
 
 void Executor::tick() {
-  std::shared_ptr<PbftBlock> pbft_block;
+  std::shared_ptr<PreparedPeriod> prepared;
   {
     std::unique_lock l(mu_);
-    if (!to_execute_) {
-      cv_.wait(l);
+    auto has_work = [this] { return stopped_ || !prepared_.empty(); };
+    if (unsynced_periods_ && sync_interval_.count()) {
+      // Last periods of idle chain are synced once sync interval passes, not with the next commit
+      if (!cv_.wait_until(l, last_sync_time_ + sync_interval_, has_work)) {
+        l.unlock();
+        syncPeriods_();
+        return;
+      }
+    } else {
+      cv_.wait(l, has_work);
     }
     if (stopped_) {
       return;
     }
-    std::swap(pbft_block, to_execute_);
+    prepared = move(prepared_.front());
+    prepared_.pop_front();
+  }
+  prefetch_cv_.notify_one();
+  execute_(*prepared);
+}
+
+std::shared_ptr<Executor::PreparedPeriod> Executor::prepare_(std::shared_ptr<PbftBlock> pbft_block) {
+  // Transactions of prepared periods are not marked as executed in db until their periods are committed
+  for (auto committed = committed_period_.load();
+       !prepared_trxs_.empty() && prepared_trxs_.front().first <= committed;) {
+    prepared_trxs_.pop_front();
   }
-  for (auto blk_n = final_chain_->last_block_number() + 1; blk_n < pbft_block->getPeriod(); ++blk_n) {
-    execute_(*load_pbft_blk(blk_n));
+  auto prepared = period_execution_.prepare(move(pbft_block), [this](trx_hash_t const &trx_h) {
+    return std::any_of(prepared_trxs_.begin(), prepared_trxs_.end(),
+                       [&](auto const &period_trxs) { return period_trxs.second.count(trx_h); });
+  });
+
+  prepared_trxs_.emplace_back(prepared->pbft_block->getPeriod(), move(prepared->trx_hashes));
+  LOG(log_dg_) << "Prepared period " << prepared->pbft_block->getPeriod() << " with " << prepared->transactions.size()
+               << " transactions";
+  return prepared;
+}
+
+void Executor::syncPeriods_() {
+  db_->syncWAL();
+  final_chain_->checkpoint_state();
+  LOG(log_nf_) << "Synced " << unsynced_periods_ << " last executed periods";
+  unsynced_periods_ = 0;
+  last_sync_time_ = std::chrono::steady_clock::now();
+}
+
+bool Executor::shouldSync_() const {
+  if (sync_each_n_periods_ && sync_each_n_periods_ <= unsynced_periods_ + 1) {
+    return true;
   }
-  execute_(*pbft_block);
+  return sync_interval_.count() && sync_interval_ <= std::chrono::steady_clock::now() - last_sync_time_;
 }
 
-void Executor::execute_(PbftBlock const &pbft_block) {
+void Executor::execute_(PreparedPeriod &prepared) {
+  auto const &pbft_block = *prepared.pbft_block;
+  auto const &finalized_dag_blk_hashes = prepared.finalized_dag_blk_hashes;
+  auto &transactions = prepared.transactions;
   auto pbft_period = pbft_block.getPeriod();
   auto const &pbft_block_hash = pbft_block.getBlockHash();
   auto const &anchor_hash = pbft_block.getPivotDagBlockHash();
-  auto finalized_dag_blk_hashes = db_->getFinalizedDagBlockHashesByAnchor(anchor_hash);
   auto batch = db_->createWriteBatch();
-  {
-    // This artificial scope will make sure we clean up the big chunk of memory allocated for this batch-processing
-    // stuff as soon as possible
-    DbStorage::MultiGetQuery db_query(db_, transactions_tmp_buf_.capacity() + 100);
-    auto dag_blks_raw = db_query.append(DbStorage::Columns::dag_blocks, finalized_dag_blk_hashes, false).execute();
-    unordered_set<h256> unique_trxs;
-    unique_trxs.reserve(transactions_tmp_buf_.capacity());
-    for (auto const &dag_blk_raw : dag_blks_raw) {
-      for (auto const &trx_h : DagBlock::extract_transactions_from_rlp(RLP(dag_blk_raw))) {
-        if (!unique_trxs.insert(trx_h).second) {
-          continue;
-        }
-        db_query.append(DbStorage::Columns::executed_transactions, trx_h);
-        db_query.append(DbStorage::Columns::transactions, trx_h);
-      }
-    }
-    auto trx_db_results = db_query.execute(false);
-    for (uint i = 0; i < unique_trxs.size(); ++i) {
-      auto has_been_executed = !trx_db_results[0 + i * 2].empty();
-      if (has_been_executed) {
-        continue;
-      }
-      // Non-executed trxs
-      auto const &trx = transactions_tmp_buf_.emplace_back(&trx_db_results[1 + i * 2], dev::eth::CheckTransaction::None,
-                                                           true, h256(db_query.get_key(1 + i * 2)));
-      if (replay_protection_service_->is_nonce_stale(trx.sender(), trx.nonce())) {
-        transactions_tmp_buf_.pop_back();
-        continue;
-      }
-      static string const dummy_val = "_";
-      db_->batch_put(*batch, DbStorage::Columns::executed_transactions, trx.sha3(), dummy_val);
-    }
-  }
+
+  // Replay protection depends on previous periods execution, so it is checked here and not in prefetch
+  transactions.erase(std::remove_if(transactions.begin(), transactions.end(),
+                                    [this](auto const &trx) {
+                                      return replay_protection_service_->is_nonce_stale(trx.sender(), trx.nonce());
+                                    }),
+                     transactions.end());
 
   // Execute transactions in EVM(GO trx engine) and update Ethereum block
-  auto const &[new_eth_header, trx_receipts, _] =
-      final_chain_->advance(batch, pbft_block.getBeneficiary(), pbft_block.getTimestamp(), transactions_tmp_buf_);
+  auto const &[new_eth_header, trx_receipts, _] = period_execution_.execute(prepared, batch);
 
   // Update replay protection service, like nonce watermark. Nonce watermark has been disabled
   replay_protection_service_->update(batch, pbft_period,
-                                     util::make_range_view(transactions_tmp_buf_).map([](auto const &trx) {
+                                     util::make_range_view(transactions).map([](auto const &trx) {
                                        return ReplayProtectionService::TransactionInfo{
                                            trx.from(),
                                            trx.nonce(),
@@ -142,13 +211,13 @@ void Executor::execute_(PbftBlock const &pbft_block) {
 
   // Update number of executed DAG blocks and transactions
   auto num_executed_dag_blk = num_executed_dag_blk_ + finalized_dag_blk_hashes.size();
-  auto num_executed_trx = num_executed_trx_ + transactions_tmp_buf_.size();
+  auto num_executed_trx = num_executed_trx_ + transactions.size();
   if (!finalized_dag_blk_hashes.empty()) {
     db_->addStatusFieldToBatch(StatusDbField::ExecutedBlkCount, num_executed_dag_blk, batch);
     db_->addStatusFieldToBatch(StatusDbField::ExecutedTrxCount, num_executed_trx, batch);
     LOG(log_nf_) << node_addr_ << " :   Executed dag blocks index #"
                  << num_executed_dag_blk_ - finalized_dag_blk_hashes.size() << "-" << num_executed_dag_blk_ - 1
-                 << " , Transactions count: " << transactions_tmp_buf_.size();
+                 << " , Transactions count: " << transactions.size();
   }
 
   // Update proposal period DAG levels map
@@ -164,15 +233,27 @@ void Executor::execute_(PbftBlock const &pbft_block) {
                                                dpos_current_max_proposal_period, batch);
 
   // Commit DB
+  bool checkpoint_state = false;
   {
     rocksdb::WriteOptions opts;
-    opts.sync = true;
+    opts.sync = shouldSync_();
     db_->commitWriteBatch(batch, opts);
+    checkpoint_state = opts.sync && sync_each_n_periods_ != 1;
+    if (opts.sync) {
+      unsynced_periods_ = 0;
+      last_sync_time_ = std::chrono::steady_clock::now();
+    } else {
+      ++unsynced_periods_;
+    }
   }
+  committed_period_ = pbft_period;
   LOG(log_nf_) << "DB write batch committed at period " << pbft_period << " PBFT block hash " << pbft_block_hash;
 
   // After DB commit, confirm in final chain(Ethereum)
   final_chain_->advance_confirm();
+  if (checkpoint_state) {
+    final_chain_->checkpoint_state();
+  }
 
   // Only NOW we are fine to modify in-memory states as they have been backed by the db
 
@@ -191,8 +272,6 @@ void Executor::execute_(PbftBlock const &pbft_block) {
     ws_server_->newEthBlock(new_eth_header);
   }
 
-  transactions_tmp_buf_.clear();
-
   LOG(log_nf_) << node_addr_ << " successful execute pbft block " << pbft_block_hash << " in period " << pbft_period;
 }
 
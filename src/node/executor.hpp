@@ -1,23 +1,45 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <deque>
 
 #include "chain/final_chain.hpp"
+#include "config/config.hpp"
 #include "consensus/pbft_chain.hpp"
 #include "consensus/vote.hpp"
 #include "dag/dag.hpp"
 #include "dag/dag_block_manager.hpp"
 #include "network/rpc/WSServer.h"
+#include "node/period_execution.hpp"
 #include "node/replay_protection_service.hpp"
 #include "transaction_manager/transaction_manager.hpp"
+#include "util/thread_pool.hpp"
 #include "util/util.hpp"
 
 namespace taraxa {
 
+/**
+ * Executes finalized PBFT periods in a pipeline:
+ * 1. prefetch worker prepares up to c_max_prefetched_periods next periods (see PeriodExecution::prepare)
+ * 2. execution worker executes prepared periods in EVM and commits them to db one by one. Execution of a period
+ *    requires previous period to be committed, state engine keeps only single pending state transition
+ */
 class Executor {
+  using PreparedPeriod = PeriodExecution::PreparedPeriod;
+
+  static constexpr size_t c_max_prefetched_periods = 8;
+
   std::mutex mu_;
   std::condition_variable cv_;
+  std::condition_variable prefetch_cv_;
   std::shared_ptr<PbftBlock> to_execute_;
+  std::deque<std::shared_ptr<PreparedPeriod>> prepared_;
+  uint64_t next_to_prepare_ = 0;
+
+  // Transactions of prepared but not yet committed periods, owned by prefetch worker
+  std::deque<std::pair<uint64_t, std::unordered_set<trx_hash_t>>> prepared_trxs_;
+  std::atomic<uint64_t> committed_period_ = 0;
 
   std::unique_ptr<ReplayProtectionService> replay_protection_service_;
   std::shared_ptr<DbStorage> db_;
@@ -31,8 +53,15 @@ class Executor {
   addr_t node_addr_;
   std::atomic<bool> stopped_ = true;
   std::unique_ptr<std::thread> exec_worker_;
+  std::unique_ptr<std::thread> prefetch_worker_;
+  util::ThreadPool sender_recovery_pool_{std::max(1u, std::thread::hardware_concurrency() / 2), false};
+  PeriodExecution const period_execution_;
 
-  dev::eth::Transactions transactions_tmp_buf_;
+  uint32_t const sync_each_n_periods_;
+  std::chrono::milliseconds const sync_interval_;
+  // Owned by execution worker
+  uint64_t unsynced_periods_ = 0;
+  std::chrono::steady_clock::time_point last_sync_time_ = std::chrono::steady_clock::now();
   std::atomic<uint64_t> num_executed_dag_blk_ = 0;
   std::atomic<uint64_t> num_executed_trx_ = 0;
 
@@ -42,7 +71,7 @@ class Executor {
   Executor(addr_t node_addr, std::shared_ptr<DbStorage> db, std::shared_ptr<DagManager> dag_mgr,
            std::shared_ptr<TransactionManager> trx_mgr, std::shared_ptr<DagBlockManager> dag_blk_mgr,
            std::shared_ptr<FinalChain> final_chain, std::shared_ptr<PbftChain> pbft_chain,
-           uint32_t expected_max_trx_per_block);
+           uint32_t expected_max_trx_per_block, ExecutorConfig const& config = {});
   ~Executor();
 
   void setWSServer(std::shared_ptr<net::WSServer> ws_server);
@@ -53,7 +82,13 @@ class Executor {
 
  private:
   void tick();
-  void execute_(PbftBlock const& blk);
+  void prefetchTick();
+  std::shared_ptr<PreparedPeriod> prepare_(std::shared_ptr<PbftBlock> pbft_block);
+  void execute_(PreparedPeriod& prepared);
+  bool shouldSync_() const;
+  // Syncs db writes of unsynced executed periods and checkpoints state db at them, called by execution worker or
+  // when it is not running
+  void syncPeriods_();
   std::shared_ptr<PbftBlock> load_pbft_blk(uint64_t pbft_period);
 };
 
@@ -10,6 +10,7 @@
 #include <stdexcept>
 
 #include "aleth/dummy_eth_apis.hpp"
+#include "aleth/eth.hpp"
 #include "aleth/node_api.hpp"
 #include "aleth/state_api.hpp"
 #include "consensus/block_proposer.hpp"
@@ -101,11 +102,12 @@ void FullNode::init() {
   emplace(vote_mgr_, node_addr, db_, final_chain_, pbft_chain_);
   emplace(trx_order_mgr_, node_addr, db_);
   emplace(executor_, node_addr, db_, dag_mgr_, trx_mgr_, dag_blk_mgr_, final_chain_, pbft_chain_,
-          conf_.test_params.block_proposer.transaction_limit);
+          conf_.test_params.block_proposer.transaction_limit, conf_.executor);
   emplace(pbft_mgr_, conf_.chain.pbft, genesis_hash, node_addr, db_, pbft_chain_, vote_mgr_, next_votes_mgr_, dag_mgr_,
           dag_blk_mgr_, final_chain_, executor_, kp_.secret(), conf_.vrf_secret);
   emplace(blk_proposer_, conf_.test_params.block_proposer, conf_.chain.vdf, dag_mgr_, trx_mgr_, dag_blk_mgr_,
-          final_chain_, node_addr, getSecretKey(), getVrfSecretKey(), log_time_);
+          final_chain_, node_addr, getSecretKey(), getVrfSecretKey(), log_time_,
+          !conf_.chain.final_chain.state.execution_options.disable_nonce_check);
   emplace(network_, conf_.network, conf_.net_file_path().string(), kp_, db_, pbft_mgr_, pbft_chain_, vote_mgr_,
           next_votes_mgr_, dag_mgr_, dag_blk_mgr_, trx_mgr_);
 
@@ -114,19 +116,21 @@ void FullNode::init() {
     jsonrpc_io_ctx_ = make_unique<boost::asio::io_context>();
 
     emplace(jsonrpc_api_, new net::Test(getShared()), new net::Taraxa(getShared()), new net::Net(getShared()),
-            new dev::rpc::Eth(aleth::NewNodeAPI(conf_.chain.chain_id, kp_.secret(),
-                                                [this](auto const &trx) {
-                                                  auto [ok, err_msg] = trx_mgr_->insertTransaction(trx);
-                                                  if (!ok) {
-                                                    BOOST_THROW_EXCEPTION(
-                                                        runtime_error(fmt("Transaction is rejected.\n"
-                                                                          "RLP: %s\n"
-                                                                          "Reason: %s",
-                                                                          dev::toJS(*trx.rlp()), err_msg)));
-                                                  }
-                                                }),
-                              std::make_shared<aleth::DummyFilterAPI>(), aleth::NewStateAPI(final_chain_),
-                              std::make_shared<aleth::DummyPendingBlock>(), final_chain_, [] { return 0; }));
+            new aleth::Eth(final_chain_, {conf_.rpc->max_logs_block_range, conf_.rpc->max_logs_results},
+                           aleth::NewNodeAPI(conf_.chain.chain_id, kp_.secret(),
+                                             [this](auto const &trx) {
+                                               auto [ok, err_msg] = trx_mgr_->insertTransaction(trx);
+                                               if (!ok) {
+                                                 BOOST_THROW_EXCEPTION(
+                                                     runtime_error(fmt("Transaction is rejected.\n"
+                                                                       "RLP: %s\n"
+                                                                       "Reason: %s",
+                                                                       dev::toJS(*trx.rlp()), err_msg)));
+                                               }
+                                             }),
+                           std::make_shared<aleth::DummyFilterAPI>(),
+                           aleth::NewStateAPI(final_chain_, conf_.eth_call),
+                           std::make_shared<aleth::DummyPendingBlock>(), final_chain_, [] { return 0; }));
 
     if (conf_.rpc->http_port) {
       jsonrpc_http_ = make_shared<net::RpcServer>(
@@ -177,6 +181,8 @@ void FullNode::start() {
 
       if (dag_mgr_->pivotAndTipsAvailable(blk)) {
         dag_mgr_->addDagBlock(blk);
+        // PBFT might wait for the block to certify its schedule
+        pbft_mgr_->wakeUp();
         if (jsonrpc_ws_) {
           jsonrpc_ws_->newDagBlock(blk);
         }
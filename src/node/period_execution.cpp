@@ -0,0 +1,81 @@
+#include "period_execution.hpp"
+
+#include "dag/dag_block.hpp"
+
+namespace taraxa {
+
+PeriodExecution::PeriodExecution(std::shared_ptr<DbStorage> db, std::shared_ptr<DbStorage> blocks_db,
+                                 std::shared_ptr<FinalChain> final_chain, util::ThreadPool &sender_recovery_pool,
+                                 uint32_t expected_max_trx_per_block)
+    : db_(move(db)),
+      blocks_db_(move(blocks_db)),
+      final_chain_(move(final_chain)),
+      sender_recovery_pool_(sender_recovery_pool),
+      expected_max_trx_per_block_(expected_max_trx_per_block) {}
+
+std::shared_ptr<PeriodExecution::PreparedPeriod> PeriodExecution::prepare(
+    std::shared_ptr<PbftBlock> pbft_block, std::function<bool(trx_hash_t const &)> const &is_prepared) const {
+  auto prepared = std::make_shared<PreparedPeriod>();
+  auto const &anchor_hash = pbft_block->getPivotDagBlockHash();
+  prepared->finalized_dag_blk_hashes = blocks_db_->getFinalizedDagBlockHashesByAnchor(anchor_hash);
+  prepared->pbft_block = move(pbft_block);
+
+  auto &transactions = prepared->transactions;
+  auto &trx_hashes = prepared->trx_hashes;
+  transactions.reserve(expected_max_trx_per_block_);
+  trx_hashes.reserve(expected_max_trx_per_block_);
+  {
+    // This artificial scope will make sure we clean up the big chunk of memory allocated for this batch-processing
+    // stuff as soon as possible
+    DbStorage::MultiGetQuery blocks_query(blocks_db_, expected_max_trx_per_block_ + 100);
+    auto dag_blks_raw =
+        blocks_query.append(DbStorage::Columns::dag_blocks, prepared->finalized_dag_blk_hashes, false).execute();
+    vector<trx_hash_t> candidates;
+    candidates.reserve(expected_max_trx_per_block_);
+    for (auto const &dag_blk_raw : dag_blks_raw) {
+      for (auto const &trx_h : DagBlock::extract_transactions_from_rlp(RLP(dag_blk_raw))) {
+        if ((is_prepared && is_prepared(trx_h)) || !trx_hashes.insert(trx_h).second) {
+          continue;
+        }
+        candidates.push_back(trx_h);
+      }
+    }
+    auto executed = DbStorage::MultiGetQuery(db_, candidates.size())
+                        .append(DbStorage::Columns::executed_transactions, candidates, false)
+                        .execute();
+    vector<trx_hash_t> not_executed;
+    not_executed.reserve(candidates.size());
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      if (executed[i].empty()) {
+        not_executed.push_back(candidates[i]);
+      } else {
+        trx_hashes.erase(candidates[i]);
+      }
+    }
+    auto trxs_raw = blocks_query.append(DbStorage::Columns::transactions, not_executed, false).execute();
+    for (size_t i = 0; i < trxs_raw.size(); ++i) {
+      transactions.emplace_back(&trxs_raw[i], dev::eth::CheckTransaction::None, true, not_executed[i]);
+    }
+  }
+
+  // Recover senders on the pool, each transaction caches its own sender
+  sender_recovery_pool_.parallel_for(transactions.size(), c_min_sender_recovery_chunk_size,
+                                     [&](size_t from, size_t to) {
+                                       for (auto idx = from; idx < to; ++idx) {
+                                         transactions[idx].sender();
+                                       }
+                                     });
+  return prepared;
+}
+
+FinalChain::AdvanceResult PeriodExecution::execute(PreparedPeriod const &prepared,
+                                                   DbStorage::BatchPtr const &batch) const {
+  for (auto const &trx : prepared.transactions) {
+    static string const dummy_val = "_";
+    db_->batch_put(*batch, DbStorage::Columns::executed_transactions, trx.sha3(), dummy_val);
+  }
+  auto const &pbft_block = *prepared.pbft_block;
+  return final_chain_->advance(batch, pbft_block.getBeneficiary(), pbft_block.getTimestamp(), prepared.transactions);
+}
+
+}  // namespace taraxa
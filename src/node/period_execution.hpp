@@ -0,0 +1,53 @@
+#pragma once
+
+#include <functional>
+#include <unordered_set>
+
+#include "chain/final_chain.hpp"
+#include "consensus/pbft_chain.hpp"
+#include "storage/db_storage.hpp"
+#include "util/thread_pool.hpp"
+
+namespace taraxa {
+
+/**
+ * Stages of execution of a single period, Executor runs them in its pipeline, replay benchmark one after another:
+ * 1. prepare: DAG blocks and not yet executed transactions of the period are loaded and decoded, senders are
+ *    recovered in parallel
+ * 2. execute: transactions are marked as executed and executed in EVM, results are written to the passed batch
+ *
+ * Blocks and transactions are loaded from blocks_db, executed transactions are checked in and marked to db. Node uses
+ * the same db for both, replay benchmark loads periods from the db of another node
+ */
+class PeriodExecution {
+ public:
+  // Period with everything needed for execution loaded from db
+  struct PreparedPeriod {
+    std::shared_ptr<PbftBlock> pbft_block;
+    vec_blk_t finalized_dag_blk_hashes;
+    dev::eth::Transactions transactions;
+    // Hashes of the transactions, those might be removed from transactions before execution
+    std::unordered_set<trx_hash_t> trx_hashes;
+  };
+
+  PeriodExecution(std::shared_ptr<DbStorage> db, std::shared_ptr<DbStorage> blocks_db,
+                  std::shared_ptr<FinalChain> final_chain, util::ThreadPool &sender_recovery_pool,
+                  uint32_t expected_max_trx_per_block = 0);
+
+  // Transactions is_prepared returns true for are skipped, those are in periods prepared but not executed yet
+  std::shared_ptr<PreparedPeriod> prepare(std::shared_ptr<PbftBlock> pbft_block,
+                                          std::function<bool(trx_hash_t const &)> const &is_prepared = {}) const;
+  // Requires the previous period to be executed and confirmed in final chain
+  FinalChain::AdvanceResult execute(PreparedPeriod const &prepared, DbStorage::BatchPtr const &batch) const;
+
+ private:
+  static constexpr size_t c_min_sender_recovery_chunk_size = 64;
+
+  std::shared_ptr<DbStorage> db_;
+  std::shared_ptr<DbStorage> blocks_db_;
+  std::shared_ptr<FinalChain> final_chain_;
+  util::ThreadPool &sender_recovery_pool_;
+  uint32_t const expected_max_trx_per_block_;
+};
+
+}  // namespace taraxa
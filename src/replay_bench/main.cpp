@@ -0,0 +1,152 @@
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+
+#include "chain/final_chain.hpp"
+#include "common/static_init.hpp"
+#include "config/config.hpp"
+#include "node/period_execution.hpp"
+#include "storage/db_storage.hpp"
+#include "util/thread_pool.hpp"
+
+using namespace taraxa;
+using namespace std;
+
+namespace bpo = boost::program_options;
+
+namespace {
+
+using Clock = chrono::steady_clock;
+
+// Microseconds spent by each stage of period execution
+struct Timings {
+  uint64_t prepare = 0;
+  uint64_t evm = 0;
+  uint64_t commit = 0;
+
+  uint64_t total() const { return prepare + evm + commit; }
+
+  Timings& operator+=(Timings const& o) {
+    prepare += o.prepare;
+    evm += o.evm;
+    commit += o.commit;
+    return *this;
+  }
+};
+
+// Returns microseconds passed since the last lap
+uint64_t lap(Clock::time_point& since) {
+  auto const now = Clock::now();
+  auto const ret = chrono::duration_cast<chrono::microseconds>(now - since).count();
+  since = now;
+  return ret;
+}
+
+double tps(uint64_t trxs, uint64_t us) { return us ? trxs * 1e6 / us : 0; }
+
+}  // namespace
+
+int main(int argc, const char* argv[]) {
+  static_init();
+
+  try {
+    string conf_taraxa;
+    string scratch_path;
+    uint64_t from = 1;
+    uint64_t to = 0;
+    bpo::options_description main_options("GENERIC OPTIONS:");
+    main_options.add_options()("help", "Print this help message and exit")(
+        "conf_taraxa", bpo::value<string>(&conf_taraxa),
+        "Config of the node which db is replayed (either json file path or inline json) [required]")(
+        "scratch_path", bpo::value<string>(&scratch_path),
+        "Directory of the db periods are executed into, must not exist [required]")(
+        "from", bpo::value<uint64_t>(&from),
+        "First measured period, periods before it are executed without measuring as state is built from genesis")(
+        "to", bpo::value<uint64_t>(&to), "Last executed period, the last executed period of the node by default");
+    bpo::variables_map option_vars;
+    bpo::store(bpo::parse_command_line(argc, argv, main_options), option_vars);
+    bpo::notify(option_vars);
+    if (option_vars.count("help")) {
+      cout << main_options << endl;
+      return 1;
+    }
+    if (!option_vars.count("conf_taraxa") || !option_vars.count("scratch_path")) {
+      cerr << "Please specify node configuration [--conf_taraxa] and scratch db directory [--scratch_path]" << endl;
+      return 1;
+    }
+    if (fs::exists(scratch_path)) {
+      cerr << "Scratch db directory " << scratch_path << " already exists" << endl;
+      return 1;
+    }
+
+    FullNodeConfig cfg(conf_taraxa, "");
+    auto src_db = make_shared<DbStorage>(cfg.db_path, 0, 0, 0, addr_t(), false, true);
+    dev::eth::ChainDBImpl src_chain(aleth::NewDatabase(src_db, DbStorage::Columns::aleth_chain),
+                                    aleth::NewDatabase(src_db, DbStorage::Columns::aleth_chain_extras));
+    auto src_last_blk = src_chain.get_last_block();
+    if (!src_last_blk) {
+      cerr << "No executed periods in " << cfg.db_path << endl;
+      return 1;
+    }
+    if (!to || src_last_blk->number() < to) {
+      to = src_last_blk->number();
+    }
+    auto db = make_shared<DbStorage>(scratch_path);
+    shared_ptr<FinalChain> final_chain = NewFinalChain(db, cfg.chain.final_chain, cfg.opts_final_chain);
+    util::ThreadPool sender_recovery_pool;
+    // Periods are loaded from the node db, executed transactions are tracked in the scratch db
+    PeriodExecution period_execution(db, src_db, final_chain, sender_recovery_pool);
+    cout << "Replaying periods 1-" << to << " of " << cfg.db_path << ", measuring from " << from << endl;
+    cout << "period,transactions,prepare_us,evm_us,commit_us" << endl;
+
+    Timings measured;
+    uint64_t measured_trxs = 0;
+    uint64_t state_root_mismatches = 0;
+    for (uint64_t period = 1; period <= to; ++period) {
+      Timings timings;
+      auto t = Clock::now();
+      auto pbft_blk_hash = src_db->getPeriodPbftBlock(period);
+      if (!pbft_blk_hash) {
+        cerr << "PBFT block of period " << period << " is not found" << endl;
+        return 1;
+      }
+      auto prepared = period_execution.prepare(src_db->getPbftBlock(*pbft_blk_hash));
+      timings.prepare = lap(t);
+
+      auto batch = db->createWriteBatch();
+      auto const result = period_execution.execute(*prepared, batch);
+      timings.evm = lap(t);
+
+      db->commitWriteBatch(batch);
+      final_chain->advance_confirm();
+      timings.commit = lap(t);
+
+      if (auto const& expected_root = src_chain.blockHeader(period).stateRoot();
+          result.new_header.stateRoot() != expected_root) {
+        ++state_root_mismatches;
+        cerr << "State root mismatch at period " << period << ": " << result.new_header.stateRoot() << " instead of "
+             << expected_root << endl;
+      }
+      if (period < from) {
+        continue;
+      }
+      measured += timings;
+      measured_trxs += prepared->transactions.size();
+      cout << period << "," << prepared->transactions.size() << "," << timings.prepare << "," << timings.evm << ","
+           << timings.commit << endl;
+    }
+
+    cout << "Periods: " << (from <= to ? to - from + 1 : 0) << ", transactions: " << measured_trxs << endl;
+    cout << "Total us: prepare " << measured.prepare << ", evm " << measured.evm << ", commit " << measured.commit
+         << endl;
+    cout << "TPS: " << tps(measured_trxs, measured.total()) << ", EVM only: " << tps(measured_trxs, measured.evm)
+         << endl;
+    cout << "State root mismatches: " << state_root_mismatches << endl;
+    return state_root_mismatches ? 1 : 0;
+  } catch (taraxa::ConfigException const& e) {
+    cerr << "Configuration exception: " << e.what() << endl;
+  } catch (...) {
+    cerr << boost::current_exception_diagnostic_information() << endl;
+  }
+  return 1;
+}
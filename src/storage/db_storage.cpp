@@ -13,7 +13,7 @@ using namespace rocksdb;
 namespace fs = std::filesystem;
 
 DbStorage::DbStorage(fs::path const& path, uint32_t db_snapshot_each_n_pbft_block, uint32_t db_max_snapshots,
-                     uint32_t db_revert_to_period, addr_t node_addr, bool rebuild)
+                     uint32_t db_revert_to_period, addr_t node_addr, bool rebuild, bool read_only)
     : path_(path),
       // First - lazy init default column for rocksdb - must be called before accessing rocksdb because of static init
       // order fail !!! For handles_ initialization is used comma-operator that evaluates first expression, but uses
@@ -56,13 +56,17 @@ DbStorage::DbStorage(fs::path const& path, uint32_t db_snapshot_each_n_pbft_bloc
     recoverToPeriod(db_revert_to_period);
   }
 
-  checkStatus(DB::Open(options, db_path_.string(), descriptors, &handles_, &db_));
+  if (read_only) {
+    openReadOnly(options, descriptors);
+  } else {
+    checkStatus(DB::Open(options, db_path_.string(), descriptors, &handles_, &db_));
+  }
   dag_blocks_count_.store(getStatusField(StatusDbField::DagBlkCount));
   dag_edge_count_.store(getStatusField(StatusDbField::DagEdgeCount));
 
   auto major_version = getStatusField(StatusDbField::DbMajorVersion);
   auto minor_version = getStatusField(StatusDbField::DbMinorVersion);
-  if (major_version == 0 && minor_version == 0) {
+  if (major_version == 0 && minor_version == 0 && !read_only) {
     saveStatusField(StatusDbField::DbMajorVersion, FullNode::c_database_major_version);
     saveStatusField(StatusDbField::DbMinorVersion, FullNode::c_database_minor_version);
   } else {
@@ -183,9 +187,30 @@ void DbStorage::deleteSnapshot(uint64_t const& period) {
   LOG(log_dg_) << "Deleted folder: " << period_path;
 }
 
+void DbStorage::openReadOnly(rocksdb::Options const& options, vector<ColumnFamilyDescriptor> const& descriptors) {
+  vector<string> existing;
+  checkStatus(DB::ListColumnFamilies(options, db_path_.string(), &existing));
+  vector<ColumnFamilyDescriptor> existing_descriptors;
+  vector<size_t> ordinals;
+  for (size_t i = 0; i < descriptors.size(); ++i) {
+    if (std::find(existing.begin(), existing.end(), descriptors[i].name) != existing.end()) {
+      existing_descriptors.push_back(descriptors[i]);
+      ordinals.push_back(i);
+    }
+  }
+  vector<ColumnFamilyHandle*> existing_handles;
+  checkStatus(DB::OpenForReadOnly(options, db_path_.string(), existing_descriptors, &existing_handles, &db_));
+  handles_.assign(Columns::all.size(), nullptr);
+  for (size_t i = 0; i < ordinals.size(); ++i) {
+    handles_[ordinals[i]] = existing_handles[i];
+  }
+}
+
 DbStorage::~DbStorage() {
   for (auto cf : handles_) {
-    checkStatus(db_->DestroyColumnFamilyHandle(cf));
+    if (cf) {
+      checkStatus(db_->DestroyColumnFamilyHandle(cf));
+    }
   }
   checkStatus(db_->Close());
   delete db_;
@@ -209,6 +234,8 @@ void DbStorage::commitWriteBatch(BatchPtr const& write_batch, rocksdb::WriteOpti
   checkStatus(status);
 }
 
+void DbStorage::syncWAL() { checkStatus(db_->SyncWAL()); }
+
 dev::bytes DbStorage::getDagBlockRaw(blk_hash_t const& hash) {
   return asBytes(lookup(toSlice(hash.asBytes()), Columns::dag_blocks));
 }
@@ -323,6 +350,14 @@ std::map<trx_hash_t, TransactionStatus> DbStorage::getAllTransactionStatus() {
   return res;
 }
 
+std::string DbStorage::getTransactionStatusIndex() { return lookup(0, Columns::trx_status_index); }
+
+void DbStorage::saveTransactionStatusIndex(std::string const& index) {
+  insert(Columns::trx_status_index, toSlice(0), toSlice(index));
+}
+
+void DbStorage::removeTransactionStatusIndex() { remove(toSlice(0), Columns::trx_status_index); }
+
 dev::bytes DbStorage::getTransactionRaw(trx_hash_t const& hash) {
   return asBytes(lookup(toSlice(hash.asBytes()), Columns::transactions));
 }
@@ -578,87 +613,107 @@ void DbStorage::removeVerifiedVoteToBatch(vote_hash_t const& vote_hash, BatchPtr
 }
 
 std::vector<Vote> DbStorage::getSoftVotes(uint64_t const& pbft_round) {
-  std::vector<Vote> soft_votes;
-  auto soft_votes_raw = asBytes(lookup(toSlice(pbft_round), Columns::soft_votes));
-
-  for (auto const& soft_vote : RLP(soft_votes_raw)) {
-    soft_votes.emplace_back(soft_vote);
-  }
-
-  return soft_votes;
+  return getRoundVotes_(Columns::soft_votes, pbft_round, soft_vote_type);
 }
 
 void DbStorage::saveSoftVotes(uint64_t const& pbft_round, std::vector<Vote> const& soft_votes) {
-  RLPStream s(soft_votes.size());
-  for (auto const& v : soft_votes) {
-    s.appendRaw(v.rlp(true));
-  }
-  insert(Columns::soft_votes, toSlice(pbft_round), toSlice(s.out()));
+  auto batch = createWriteBatch();
+  addSoftVotesToBatch(pbft_round, soft_votes, batch);
+  commitWriteBatch(batch);
 }
 
 void DbStorage::addSoftVotesToBatch(uint64_t const& pbft_round, std::vector<Vote> const& soft_votes,
                                     BatchPtr const& write_batch) {
-  RLPStream s(soft_votes.size());
-  for (auto const& v : soft_votes) {
-    s.appendRaw(v.rlp(true));
-  }
-  batch_put(write_batch, Columns::soft_votes, toSlice(pbft_round), toSlice(s.out()));
+  addRoundVotesToBatch_(Columns::soft_votes, pbft_round, soft_vote_type, soft_votes, write_batch);
 }
 
 void DbStorage::removeSoftVotesToBatch(uint64_t const& pbft_round, BatchPtr const& write_batch) {
-  batch_delete(write_batch, Columns::soft_votes, toSlice(pbft_round));
+  removeRoundVotesToBatch_(Columns::soft_votes, pbft_round, soft_vote_type, write_batch);
 }
 
 std::vector<Vote> DbStorage::getCertVotes(blk_hash_t const& hash) {
-  std::vector<Vote> cert_votes;
   auto cert_votes_raw = asBytes(lookup(toSlice(hash.asBytes()), Columns::cert_votes));
-
-  for (auto const& cert_vote : RLP(cert_votes_raw)) {
-    cert_votes.emplace_back(cert_vote);
+  if (cert_votes_raw.empty()) {
+    return {};
   }
-
-  return cert_votes;
+  return decodeCertVotes(hash, RLP(cert_votes_raw));
 }
 
 void DbStorage::addCertVotesToBatch(const taraxa::blk_hash_t& pbft_block_hash, const std::vector<Vote>& cert_votes,
                                     const taraxa::DbStorage::BatchPtr& write_batch) {
-  RLPStream s(cert_votes.size());
-  for (auto const& v : cert_votes) {
-    s.appendRaw(v.rlp(true));
-  }
-  batch_put(*write_batch, Columns::cert_votes, toSlice(pbft_block_hash.asBytes()), toSlice(s.out()));
+  batch_put(*write_batch, Columns::cert_votes, toSlice(pbft_block_hash.asBytes()),
+            toSlice(encodeCertVotes(pbft_block_hash, cert_votes)));
 }
 
 std::vector<Vote> DbStorage::getNextVotes(uint64_t const& pbft_round) {
-  std::vector<Vote> next_votes;
-  auto next_votes_raw = asBytes(lookup(toSlice(pbft_round), Columns::next_votes));
-
-  for (auto const& next_vote : RLP(next_votes_raw)) {
-    next_votes.emplace_back(next_vote);
-  }
-
-  return next_votes;
+  return getRoundVotes_(Columns::next_votes, pbft_round, next_vote_type);
 }
 
 void DbStorage::saveNextVotes(uint64_t const& pbft_round, std::vector<Vote> const& next_votes) {
-  RLPStream s(next_votes.size());
-  for (auto const& v : next_votes) {
-    s.appendRaw(v.rlp(true));
-  }
-  insert(Columns::next_votes, toSlice(pbft_round), toSlice(s.out()));
+  auto batch = createWriteBatch();
+  addNextVotesToBatch(pbft_round, next_votes, batch);
+  commitWriteBatch(batch);
 }
 
 void DbStorage::addNextVotesToBatch(uint64_t const& pbft_round, std::vector<Vote> const& next_votes,
                                     BatchPtr const& write_batch) {
-  RLPStream s(next_votes.size());
-  for (auto const& v : next_votes) {
-    s.appendRaw(v.rlp(true));
-  }
-  batch_put(*write_batch, Columns::next_votes, toSlice(pbft_round), toSlice(s.out()));
+  addRoundVotesToBatch_(Columns::next_votes, pbft_round, next_vote_type, next_votes, write_batch);
 }
 
 void DbStorage::removeNextVotesToBatch(uint64_t const& pbft_round, BatchPtr const& write_batch) {
-  batch_delete(write_batch, Columns::next_votes, toSlice(pbft_round));
+  removeRoundVotesToBatch_(Columns::next_votes, pbft_round, next_vote_type, write_batch);
+}
+
+namespace {
+
+// Big endian round goes first, so that votes of a round are adjacent
+bytes roundVotesPrefix(uint64_t round, PbftVoteTypes type) {
+  bytes prefix(sizeof(round) + 1);
+  for (size_t i = 0; i < sizeof(round); ++i) {
+    prefix[i] = (round >> (8 * (sizeof(round) - 1 - i))) & 0xff;
+  }
+  prefix.back() = type;
+  return prefix;
+}
+
+}  // namespace
+
+std::vector<Vote> DbStorage::getRoundVotes_(Column const& col, uint64_t round, PbftVoteTypes type) {
+  std::vector<Vote> votes;
+  // Written before votes were stored one per key
+  if (auto legacy_votes_raw = asBytes(lookup(toSlice(round), col)); !legacy_votes_raw.empty()) {
+    for (auto const& vote : RLP(legacy_votes_raw)) {
+      votes.emplace_back(vote);
+    }
+  }
+
+  auto const prefix = roundVotesPrefix(round, type);
+  auto it = u_ptr(db_->NewIterator(read_options_, handle(col)));
+  for (it->Seek(toSlice(prefix)); it->Valid() && it->key().starts_with(toSlice(prefix)); it->Next()) {
+    votes.emplace_back(asBytes(it->value().ToString()));
+  }
+  return votes;
+}
+
+void DbStorage::addRoundVotesToBatch_(Column const& col, uint64_t round, PbftVoteTypes type,
+                                      std::vector<Vote> const& votes, BatchPtr const& write_batch) {
+  auto key = roundVotesPrefix(round, type);
+  auto const prefix_size = key.size();
+  for (auto const& v : votes) {
+    key.resize(prefix_size);
+    auto const& hash = v.getHash();
+    key.insert(key.end(), hash.begin(), hash.end());
+    batch_put(write_batch, col, toSlice(key), toSlice(v.rlp(true)));
+  }
+}
+
+void DbStorage::removeRoundVotesToBatch_(Column const& col, uint64_t round, PbftVoteTypes type,
+                                         BatchPtr const& write_batch) {
+  batch_delete(write_batch, col, toSlice(round));
+  auto const begin = roundVotesPrefix(round, type);
+  auto end = begin;
+  ++end.back();
+  checkStatus(write_batch->DeleteRange(handle(col), toSlice(begin), toSlice(end)));
 }
 
 shared_ptr<blk_hash_t> DbStorage::getPeriodPbftBlock(uint64_t const& period) {
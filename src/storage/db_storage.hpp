@@ -104,9 +104,9 @@ struct DbStorage {
     COLUMN(pbft_blocks);
     COLUMN(unverified_votes);
     COLUMN(verified_votes);
-    COLUMN(soft_votes);  // only for current PBFT round
+    COLUMN(soft_votes);  // only for current PBFT round, <round, type, vote hash> keys
     COLUMN(cert_votes);  // for each PBFT block
-    COLUMN(next_votes);  // only for previous PBFT round
+    COLUMN(next_votes);  // only for previous PBFT round, <round, type, vote hash> keys
     COLUMN(period_pbft_block);
     COLUMN(dag_block_period);
     COLUMN(dpos_proposal_period_levels_status);
@@ -115,6 +115,11 @@ struct DbStorage {
     COLUMN(pending_transactions);
     COLUMN(aleth_chain);
     COLUMN(aleth_chain_extras);
+    // block_number->logs of the block, see LogIndex
+    COLUMN(block_logs);
+    COLUMN(log_bloombits);
+    // snapshot of TransactionStatusIndex saved on shutdown, removed when loaded
+    COLUMN(trx_status_index);
 
 #undef COLUMN
   };
@@ -140,6 +145,13 @@ struct DbStorage {
   bool minor_version_changed_ = false;
 
   auto handle(Column const& col) const { return handles_[col.ordinal]; }
+  // Votes of a round are stored under a key each, adding a vote doesn't rewrite the others. Loading iterates the
+  // <round, type> prefix, it also reads the legacy value with all votes of the round under the round key
+  std::vector<Vote> getRoundVotes_(Column const& col, uint64_t round, PbftVoteTypes type);
+  void addRoundVotesToBatch_(Column const& col, uint64_t round, PbftVoteTypes type, std::vector<Vote> const& votes,
+                             BatchPtr const& write_batch);
+  void removeRoundVotesToBatch_(Column const& col, uint64_t round, PbftVoteTypes type, BatchPtr const& write_batch);
+  void openReadOnly(rocksdb::Options const& options, std::vector<rocksdb::ColumnFamilyDescriptor> const& descriptors);
 
   LOG_OBJECTS_DEFINE
 
@@ -147,17 +159,26 @@ struct DbStorage {
   DbStorage(DbStorage const&) = delete;
   DbStorage& operator=(DbStorage const&) = delete;
 
+  /**
+   * @param read_only opens existing db for reads only, columns missing in db are not opened and can't be accessed
+   */
   explicit DbStorage(fs::path const& base_path, uint32_t db_snapshot_each_n_pbft_block = 0,
                      uint32_t db_max_snapshots = 0, uint32_t db_revert_to_period = 0, addr_t node_addr = addr_t(),
-                     bool rebuild = 0);
+                     bool rebuild = 0, bool read_only = 0);
   ~DbStorage();
 
   auto const& path() const { return path_; }
   auto dbStoragePath() const { return db_path_; }
   auto stateDbStoragePath() const { return state_db_path_; }
+  // Checkpoint of state db taken at a period synced in main db, see FinalChain::checkpoint_state
+  auto stateDbCheckpointPath() const {
+    return state_db_path_.parent_path() / ("synced_" + state_db_path_.filename().string());
+  }
   static BatchPtr createWriteBatch();
   void commitWriteBatch(BatchPtr const& write_batch, rocksdb::WriteOptions const& opts);
   void commitWriteBatch(BatchPtr const& write_batch) { commitWriteBatch(write_batch, write_options_); }
+  // Makes writes committed without sync durable
+  void syncWAL();
 
   bool createSnapshot(uint64_t const& period);
   void deleteSnapshot(uint64_t const& period);
@@ -188,6 +209,9 @@ struct DbStorage {
   void addTransactionStatusToBatch(BatchPtr const& write_batch, trx_hash_t const& trx, TransactionStatus const& status);
   TransactionStatus getTransactionStatus(trx_hash_t const& hash);
   std::map<trx_hash_t, TransactionStatus> getAllTransactionStatus();
+  std::string getTransactionStatusIndex();
+  void saveTransactionStatusIndex(std::string const& index);
+  void removeTransactionStatusIndex();
 
   // PBFT manager
   uint64_t getPbftMgrField(PbftMgrRoundStep const& field);
@@ -260,6 +284,7 @@ struct DbStorage {
                            BatchPtr const& write_batch);
   // Next votes
   std::vector<Vote> getNextVotes(uint64_t const& pbft_round);
+  // Adds the votes, votes of the round saved before are kept
   void saveNextVotes(uint64_t const& pbft_round, std::vector<Vote> const& next_votes);
   void addNextVotesToBatch(uint64_t const& pbft_round, std::vector<Vote> const& next_votes,
                            BatchPtr const& write_batch);
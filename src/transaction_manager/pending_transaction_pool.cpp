@@ -0,0 +1,221 @@
+#include "pending_transaction_pool.hpp"
+
+#include <queue>
+
+namespace taraxa {
+
+addr_t PendingTransactionPool::getIndexSender(Transaction const &trx) {
+  try {
+    return trx.getSender();
+  } catch (Transaction::InvalidSignature const &) {
+    return addr_t();
+  }
+}
+
+bool PendingTransactionPool::insert(trx_hash_t const &hash, listIter iter) {
+  if (by_hash_.count(hash)) {
+    return false;
+  }
+  auto sender = getIndexSender(*iter);
+  NonceKey key{iter->getNonce(), hash};
+  auto &queue = by_sender_[sender];
+  eraseTail(sender, queue);
+  queue.emplace(key, Entry{hash, iter, seq_++});
+  insertTail(sender, queue);
+  by_hash_.emplace(hash, std::make_pair(sender, key));
+  return true;
+}
+
+bool PendingTransactionPool::erase(trx_hash_t const &hash) {
+  auto it = by_hash_.find(hash);
+  if (it == by_hash_.end()) {
+    return false;
+  }
+  auto const &[sender, key] = it->second;
+  if (auto queue = by_sender_.find(sender); queue != by_sender_.end()) {
+    eraseTail(sender, queue->second);
+    queue->second.erase(key);
+    if (queue->second.empty()) {
+      by_sender_.erase(queue);
+    } else {
+      insertTail(sender, queue->second);
+    }
+  }
+  by_hash_.erase(it);
+  return true;
+}
+
+void PendingTransactionPool::clear() {
+  by_sender_.clear();
+  by_hash_.clear();
+  tails_.clear();
+  next_nonces_.clear();
+}
+
+void PendingTransactionPool::eraseTail(addr_t const &sender, SenderQueue const &queue) {
+  if (queue.empty()) {
+    return;
+  }
+  auto const &tail = queue.rbegin()->second;
+  tails_.erase({tail.iter->getGasPrice(), tail.seq, sender});
+}
+
+void PendingTransactionPool::insertTail(addr_t const &sender, SenderQueue const &queue) {
+  if (queue.empty()) {
+    return;
+  }
+  auto const &tail = queue.rbegin()->second;
+  tails_.emplace(tail.iter->getGasPrice(), tail.seq, sender);
+}
+
+std::optional<PendingTransactionPool::Item> PendingTransactionPool::find(addr_t const &sender, uint64_t nonce) const {
+  auto queue = by_sender_.find(sender);
+  if (queue == by_sender_.end()) {
+    return std::nullopt;
+  }
+  auto it = queue->second.lower_bound({nonce, trx_hash_t()});
+  if (it == queue->second.end() || it->first.first != nonce) {
+    return std::nullopt;
+  }
+  return Item{it->second.hash, it->second.iter};
+}
+
+std::optional<PendingTransactionPool::Item> PendingTransactionPool::senderTail(addr_t const &sender) const {
+  auto queue = by_sender_.find(sender);
+  if (queue == by_sender_.end()) {
+    return std::nullopt;
+  }
+  auto const &tail = queue->second.rbegin()->second;
+  return Item{tail.hash, tail.iter};
+}
+
+std::optional<PendingTransactionPool::Item> PendingTransactionPool::evictionCandidate() const {
+  if (tails_.empty()) {
+    return std::nullopt;
+  }
+  return senderTail(std::get<2>(*tails_.begin()));
+}
+
+size_t PendingTransactionPool::senderSize(addr_t const &sender) const {
+  auto queue = by_sender_.find(sender);
+  return queue == by_sender_.end() ? 0 : queue->second.size();
+}
+
+bool PendingTransactionPool::dropStaleHeads(std::unordered_map<addr_t, SenderQueue>::iterator queue,
+                                            uint64_t expected_nonce, std::vector<Item> *stale) {
+  auto const &sender = queue->first;
+  auto &sender_queue = queue->second;
+  if (sender_queue.begin()->first.first >= expected_nonce) {
+    return true;
+  }
+  eraseTail(sender, sender_queue);
+  while (!sender_queue.empty() && sender_queue.begin()->first.first < expected_nonce) {
+    auto const &head = sender_queue.begin()->second;
+    if (stale) {
+      stale->emplace_back(head.hash, head.iter);
+    }
+    by_hash_.erase(head.hash);
+    sender_queue.erase(sender_queue.begin());
+  }
+  if (sender_queue.empty()) {
+    by_sender_.erase(queue);
+    return false;
+  }
+  insertTail(sender, sender_queue);
+  return true;
+}
+
+std::vector<PendingTransactionPool::Item> PendingTransactionPool::popExecutable(size_t max_count,
+                                                                                SenderFilter const &sender_filter,
+                                                                                NonceGetter const &state_nonce,
+                                                                                std::vector<Item> *stale) {
+  std::vector<Item> res;
+
+  // Heap of sender queue heads: highest gas price first, the oldest transaction first for equal gas price
+  using HeapItem = std::tuple<val_t, uint64_t, addr_t>;
+  auto heap_cmp = [](HeapItem const &a, HeapItem const &b) {
+    if (std::get<0>(a) != std::get<0>(b)) {
+      return std::get<0>(a) < std::get<0>(b);
+    }
+    return std::get<1>(a) > std::get<1>(b);
+  };
+  std::priority_queue<HeapItem, std::vector<HeapItem>, decltype(heap_cmp)> heads(heap_cmp);
+
+  // Without state nonces (nonce check disabled in chain) nonces only order transactions of a sender
+  bool const track_nonces = static_cast<bool>(state_nonce);
+
+  for (auto queue = by_sender_.begin(); queue != by_sender_.end();) {
+    auto const sender = queue->first;
+    auto next = std::next(queue);
+    if (sender_filter && !sender_filter(sender)) {
+      queue = next;
+      continue;
+    }
+    std::optional<uint64_t> expected_nonce;
+    if (track_nonces) {
+      if (auto packed = next_nonces_.find(sender); packed != next_nonces_.end()) {
+        expected_nonce = packed->second;
+      }
+      if (auto nonce = state_nonce(sender); nonce && (!expected_nonce || *expected_nonce < *nonce)) {
+        expected_nonce = nonce;
+      }
+      if (expected_nonce && !dropStaleHeads(queue, *expected_nonce, stale)) {
+        queue = next;
+        continue;
+      }
+    }
+    auto const &head = *queue->second.begin();
+    if (!expected_nonce || head.first.first == *expected_nonce) {
+      heads.emplace(head.second.iter->getGasPrice(), head.second.seq, sender);
+    }
+    queue = next;
+  }
+
+  while (!heads.empty() && (max_count == 0 || res.size() < max_count)) {
+    auto sender = std::get<2>(heads.top());
+    heads.pop();
+
+    auto queue = by_sender_.find(sender);
+    auto head = queue->second.begin();
+    auto const next_nonce = head->first.first + 1;
+    res.emplace_back(head->second.hash, head->second.iter);
+    by_hash_.erase(head->second.hash);
+    eraseTail(sender, queue->second);
+    queue->second.erase(head);
+    if (track_nonces) {
+      next_nonces_[sender] = next_nonce;
+    }
+
+    if (queue->second.empty()) {
+      by_sender_.erase(queue);
+      continue;
+    }
+    insertTail(sender, queue->second);
+
+    if (!track_nonces) {
+      auto const &next = queue->second.begin()->second;
+      heads.emplace(next.iter->getGasPrice(), next.seq, sender);
+      continue;
+    }
+
+    // Next transaction of the sender is executable only if there is no nonce gap, transactions with the same nonce as
+    // the popped one are dropped
+    if (!dropStaleHeads(queue, next_nonce, stale)) {
+      continue;
+    }
+    auto const &next = queue->second.begin();
+    if (next->first.first == next_nonce) {
+      heads.emplace(next->second.iter->getGasPrice(), next->second.seq, sender);
+    }
+  }
+
+  if (next_nonces_.size() > c_max_tracked_senders) {
+    for (auto it = next_nonces_.begin(); it != next_nonces_.end();) {
+      it = by_sender_.count(it->first) ? std::next(it) : next_nonces_.erase(it);
+    }
+  }
+
+  return res;
+}
+
+}  // namespace taraxa
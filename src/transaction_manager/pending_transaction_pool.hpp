@@ -0,0 +1,121 @@
+#pragma once
+
+#include <functional>
+#include <list>
+#include <map>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "transaction.hpp"
+
+namespace taraxa {
+
+/**
+ * Index over verified transactions used for block packing
+ * 1. Per-sender queues ordered by nonce
+ * 2. Global gas price priority between senders, only queue heads compete
+ * 3. Eviction order over sender queue tails: the lowest gas price first, the oldest first for equal gas price. Only
+ *    tails are evicted so that no nonce gaps are created in sender queues
+ * 4. Expected next nonce per sender: the last packed nonce + 1, or the account state nonce if nothing was packed
+ *    (or state is already ahead). Only a head with the expected nonce is executable. Tracked only if state nonces are
+ *    provided for packing, otherwise nonces just order sender's transactions
+ *
+ * Not thread safe, the owner (TransactionQueue) guards it with its verified queue mutex
+ */
+class PendingTransactionPool {
+ public:
+  using listIter = std::list<Transaction>::iterator;
+  using SenderFilter = std::function<bool(addr_t const &)>;
+  using NonceGetter = std::function<std::optional<uint64_t>(addr_t const &)>;
+  using Item = std::pair<trx_hash_t, listIter>;
+
+  /**
+   * @brief Adds transaction to the index
+   *
+   * @param hash transaction hash
+   * @param iter iterator into the transaction buffer owned by TransactionQueue
+   * @return false if transaction is already indexed
+   */
+  bool insert(trx_hash_t const &hash, listIter iter);
+
+  /**
+   * @brief Removes transaction from the index
+   *
+   * @return false if transaction was not indexed
+   */
+  bool erase(trx_hash_t const &hash);
+
+  /**
+   * @brief Pops executable transactions from the index, ordered by gas price between senders and by nonce within a
+   *        sender. If nonces are tracked, sender's transactions after a nonce gap stay in the index until the gap is
+   *        filled and transactions with nonce lower than expected (already packed or executed) are dropped
+   *
+   * @param max_count max number of transactions to pop, 0 means no limit
+   * @param sender_filter only senders accepted by filter are considered, empty filter accepts all senders
+   * @param state_nonce account nonce of sender in state, empty getter disables nonce tracking. If getter returns
+   *        nullopt and nothing was packed for the sender yet, its queue head is considered executable
+   * @param stale if set, dropped transactions are appended to it
+   * @return popped transactions in packing order
+   */
+  std::vector<Item> popExecutable(size_t max_count = 0, SenderFilter const &sender_filter = {},
+                                  NonceGetter const &state_nonce = {}, std::vector<Item> *stale = nullptr);
+
+  /**
+   * @return transaction of sender with the nonce, the oldest one if there are more of them
+   */
+  std::optional<Item> find(addr_t const &sender, uint64_t nonce) const;
+
+  /**
+   * @return transaction of sender with the highest nonce
+   */
+  std::optional<Item> senderTail(addr_t const &sender) const;
+
+  /**
+   * @return next transaction to be evicted: sender queue tail with the lowest gas price, the oldest one for equal
+   *         gas price
+   */
+  std::optional<Item> evictionCandidate() const;
+
+  size_t senderSize(addr_t const &sender) const;
+  size_t size() const { return by_hash_.size(); }
+  bool empty() const { return by_hash_.empty(); }
+  void clear();
+
+  /**
+   * @brief Sender used for indexing, transactions with invalid signature are indexed under zero address
+   */
+  static addr_t getIndexSender(Transaction const &trx);
+
+ private:
+  struct Entry {
+    trx_hash_t hash;
+    listIter iter;
+    uint64_t seq = 0;
+  };
+  // (nonce, hash) so that transactions with equal nonce can coexist in sender queue
+  using NonceKey = std::pair<uint64_t, trx_hash_t>;
+  using SenderQueue = std::map<NonceKey, Entry>;
+
+  // (gas price, seq, sender) of each sender queue tail
+  using TailKey = std::tuple<val_t, uint64_t, addr_t>;
+  void eraseTail(addr_t const &sender, SenderQueue const &queue);
+  void insertTail(addr_t const &sender, SenderQueue const &queue);
+  // Drops queue heads with nonce lower than expected, returns false if sender queue got empty and was erased
+  bool dropStaleHeads(std::unordered_map<addr_t, SenderQueue>::iterator queue, uint64_t expected_nonce,
+                      std::vector<Item> *stale);
+
+  // Records of senders without queued transactions are dropped over this limit, their expected nonce is then taken
+  // from state again
+  static constexpr size_t c_max_tracked_senders = 100000;
+
+  std::unordered_map<addr_t, SenderQueue> by_sender_;
+  std::set<TailKey> tails_;
+  std::unordered_map<trx_hash_t, std::pair<addr_t, NonceKey>> by_hash_;
+  std::unordered_map<addr_t, uint64_t> next_nonces_;  // last packed nonce + 1
+  uint64_t seq_ = 0;
+};
+
+}  // namespace taraxa
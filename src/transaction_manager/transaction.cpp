@@ -140,6 +140,11 @@ shared_ptr<bytes> Transaction::rlp(bool cache) const {
   return cache ? cached_rlp_ = move(ret) : ret;
 }
 
+size_t Transaction::memoryUsage() const {
+  auto rlp = cached_rlp_;
+  return sizeof(Transaction) + data_.capacity() + (rlp ? sizeof(bytes) + rlp->capacity() : 0);
+}
+
 trx_hash_t Transaction::hash_for_signature() const {
   dev::RLPStream s;
   streamRLP<true>(s);
@@ -68,6 +68,11 @@ struct Transaction {
 
   std::shared_ptr<bytes> rlp(bool cache = false) const;
 
+  /**
+   * @return approximate number of bytes the transaction holds in memory, including cached rlp
+   */
+  size_t memoryUsage() const;
+
   Json::Value toJSON() const;
 };
 
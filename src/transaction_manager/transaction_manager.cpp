@@ -2,7 +2,9 @@
 
 #include <libethcore/Exceptions.h>
 
+#include <algorithm>
 #include <string>
+#include <unordered_set>
 #include <utility>
 
 #include "dag/dag.hpp"
@@ -25,10 +27,112 @@ auto trxComp = [](Transaction const &t1, Transaction const &t2) -> bool {
 
 TransactionManager::TransactionManager(FullNodeConfig const &conf, addr_t node_addr, std::shared_ptr<DbStorage> db,
                                        logger::Logger log_time)
-    : db_(db), conf_(conf), trx_qu_(node_addr), node_addr_(node_addr), log_time_(log_time) {
+    : db_(db),
+      conf_(conf),
+      trx_qu_(node_addr, conf.transaction_pool),
+      trx_status_index_(TransactionStatusIndex::capacityFor(db->getStatusField(StatusDbField::TrxCount))),
+      node_addr_(node_addr),
+      log_time_(log_time) {
   LOG_OBJECTS_CREATE("TRXMGR");
   auto trx_count = db_->getStatusField(taraxa::StatusDbField::TrxCount);
   trx_count_.store(trx_count);
+  loadTransactionStatusIndex_();
+}
+
+void TransactionManager::loadTransactionStatusIndex_() {
+  // Saved index is removed right after loading, so that it is not used after unclean shutdown when it might miss
+  // statuses written later
+  if (auto saved = db_->getTransactionStatusIndex(); !saved.empty()) {
+    db_->removeTransactionStatusIndex();
+    if (trx_status_index_.load(saved)) {
+      LOG(log_nf_) << "Transaction status index loaded";
+      return;
+    }
+  }
+
+  uint64_t loaded = 0;
+  db_->forEach(DbStorage::Columns::trx_status, [&](auto const &key, auto const &value) {
+    auto status = (TransactionStatus) * (uint16_t *)(value.data());
+    trx_status_index_.update(trx_hash_t(DbStorage::asBytes(key.ToString())), status);
+    ++loaded;
+    return true;
+  });
+  LOG(log_nf_) << "Transaction status index rebuilt from " << loaded << " transactions";
+}
+
+void TransactionManager::saveTransactionStatusIndex_() {
+  try {
+    db_->saveTransactionStatusIndex(trx_status_index_.serialize());
+    LOG(log_nf_) << "Transaction status index saved";
+  } catch (std::exception const &e) {
+    LOG(log_er_) << "Transaction status index not saved, it will be rebuilt on next start: " << e.what();
+  }
+}
+
+TransactionStatus TransactionManager::getTransactionStatus(trx_hash_t const &hash) const {
+  if (auto status = trx_status_index_.get(hash)) {
+    return *status;
+  }
+  return db_->getTransactionStatus(hash);
+}
+
+std::vector<TransactionStatus> TransactionManager::getTransactionsStatuses(vec_trx_t const &hashes) const {
+  std::vector<TransactionStatus> statuses(hashes.size(), TransactionStatus::not_seen);
+  std::vector<size_t> db_lookups;
+  DbStorage::MultiGetQuery db_query(db_);
+  for (size_t idx = 0; idx < hashes.size(); idx++) {
+    if (auto status = trx_status_index_.get(hashes[idx])) {
+      statuses[idx] = *status;
+    } else {
+      db_query.append(DbStorage::Columns::trx_status, hashes[idx]);
+      db_lookups.push_back(idx);
+    }
+  }
+  if (db_lookups.empty()) {
+    return statuses;
+  }
+  auto db_statuses = db_query.execute();
+  for (size_t i = 0; i < db_lookups.size(); i++) {
+    if (auto const &raw_status = db_statuses[i]; !raw_status.empty()) {
+      statuses[db_lookups[i]] = (TransactionStatus) * (uint16_t *)&raw_status[0];
+    }
+  }
+  return statuses;
+}
+
+void TransactionManager::saveTransactionStatus(trx_hash_t const &hash, TransactionStatus status) {
+  db_->saveTransactionStatus(hash, status);
+  trx_status_index_.update(hash, status);
+}
+
+void TransactionManager::addTransactionStatusToBatch(DbStorage::BatchPtr const &write_batch, trx_hash_t const &hash,
+                                                     TransactionStatus status, StatusUpdates &status_updates) {
+  db_->addTransactionStatusToBatch(write_batch, hash, status);
+  status_updates.emplace_back(hash, status);
+}
+
+void TransactionManager::commitWriteBatch_(DbStorage::BatchPtr const &write_batch,
+                                           StatusUpdates const &status_updates) {
+  db_->commitWriteBatch(write_batch);
+  for (auto const &[hash, status] : status_updates) {
+    trx_status_index_.update(hash, status);
+  }
+}
+
+void TransactionManager::markEvictedTransactions_(std::vector<trx_hash_t> const &hashes) {
+  if (hashes.empty()) {
+    return;
+  }
+  auto statuses = getTransactionsStatuses(hashes);
+  auto write_batch = db_->createWriteBatch();
+  StatusUpdates status_updates;
+  for (size_t idx = 0; idx < hashes.size(); idx++) {
+    if (statuses[idx] == TransactionStatus::in_queue_verified) {
+      addTransactionStatusToBatch(write_batch, hashes[idx], TransactionStatus::evicted, status_updates);
+    }
+  }
+  commitWriteBatch_(write_batch, status_updates);
+  LOG(log_dg_) << status_updates.size() << " transactions evicted from pool";
 }
 
 std::pair<bool, std::string> TransactionManager::verifyTransaction(Transaction const &trx) const {
@@ -73,8 +177,8 @@ bool TransactionManager::checkQueueOverflow() {
 std::pair<bool, std::string> TransactionManager::insertTransaction(const Transaction &trx, bool verify,
                                                                    bool broadcast) {
   if (checkQueueOverflow() == true) {
-    LOG(log_er_) << "Queue overlfow";
-    return std::make_pair(false, "Queue overlfow");
+    LOG(log_er_) << "Queue overflow";
+    return std::make_pair(false, "Queue overflow");
   }
 
   if (verify && mode_ != VerifyMode::skip_verify_sig) {
@@ -86,8 +190,8 @@ std::pair<bool, std::string> TransactionManager::insertTransaction(const Transac
 
   auto hash = trx.getHash();
 
-  TransactionStatus status = db_->getTransactionStatus(hash);
-  if (status != TransactionStatus::not_seen) {
+  TransactionStatus status = getTransactionStatus(hash);
+  if (status != TransactionStatus::not_seen && status != TransactionStatus::evicted) {
     switch (status) {
       case TransactionStatus::in_queue_verified:
         LOG(log_dg_) << "Trx: " << hash << "skip, seen in verified queue. " << std::endl;
@@ -106,101 +210,197 @@ std::pair<bool, std::string> TransactionManager::insertTransaction(const Transac
     }
   }
 
+  if (const auto admitted = trx_qu_.checkPoolLimits(trx); !admitted.first) {
+    LOG(log_dg_) << "Trx: " << hash << " rejected by pool: " << admitted.second;
+    return admitted;
+  }
+
   status = verify ? TransactionStatus::in_queue_verified : TransactionStatus::in_queue_unverified;
   db_->saveTransaction(trx);
-  db_->saveTransactionStatus(hash, status);
-  trx_qu_.insert(trx, verify);
+  saveTransactionStatus(hash, status);
+  markEvictedTransactions_(trx_qu_.insert(trx, verify));
 
   if (ws_server_) ws_server_->newPendingTransaction(trx.getHash());
 
   if (broadcast == true) {
     if (auto net = network_.lock(); net && conf_.network.network_transaction_interval == 0) {
-      net->onNewTransactions({*trx.rlp()});
+      net->onNewTransactions({trx});
     }
   }
 
   return std::make_pair(true, "");
 }
 
-uint32_t TransactionManager::insertBroadcastedTransactions(const std::vector<taraxa::bytes> &raw_trxs) {
+std::vector<std::pair<bool, std::string>> TransactionManager::verifyTransactions(std::vector<Transaction> const &trxs) {
+  std::vector<std::pair<bool, std::string>> results(trxs.size(), {true, ""});
+  if (mode_ == VerifyMode::skip_verify_sig) {
+    return results;
+  }
+
+  // Each chunk writes only its own results, secp256k1 context is shared by all recoveries (see dev::recover)
+  batch_verifiers_.parallel_for(trxs.size(), c_min_verification_chunk_size, [&](size_t from, size_t to) {
+    for (auto idx = from; idx < to; ++idx) {
+      results[idx] = verifyTransaction(trxs[idx]);
+    }
+  });
+  return results;
+}
+
+void TransactionManager::insertBroadcastedTransactions(std::vector<taraxa::bytes> raw_trxs,
+                                                       std::function<void(vec_trx_t const &)> on_decoded,
+                                                       std::function<void(uint32_t)> on_inserted) {
   if (stopped_) {
-    return 0;
+    return;
   }
 
+  batch_verifiers_.post([this, raw_trxs = std::move(raw_trxs), on_decoded = std::move(on_decoded),
+                         on_inserted = std::move(on_inserted)] {
+    auto results = insertRawTransactions(raw_trxs, true, on_decoded);
+    uint32_t inserted =
+        std::count_if(results.begin(), results.end(), [](auto const &res) { return res.second.empty(); });
+
+    LOG(log_nf_) << raw_trxs.size() << " received txs processed (" << inserted
+                 << " unseen -> verified and inserted into db).";
+    if (on_inserted) {
+      on_inserted(inserted);
+    }
+  });
+}
+
+std::vector<std::pair<trx_hash_t, std::string>> TransactionManager::insertRawTransactions(
+    const std::vector<taraxa::bytes> &raw_trxs, bool broadcast,
+    std::function<void(vec_trx_t const &)> const &on_decoded) {
+  std::vector<std::pair<trx_hash_t, std::string>> results(raw_trxs.size());
+
   if (checkQueueOverflow() == true) {
-    return 0;
+    for (auto &res : results) {
+      res.second = "Queue overflow";
+    }
+    return results;
   }
 
   std::vector<trx_hash_t> trxs_hashes;
   std::vector<Transaction> trxs;
+  std::vector<size_t> trxs_positions;
   std::vector<Transaction> unseen_trxs;
 
   trxs_hashes.reserve(raw_trxs.size());
   trxs.reserve(raw_trxs.size());
-  unseen_trxs.reserve(raw_trxs.size());
-
-  for (const auto &raw_trx : raw_trxs) {
-    Transaction trx = Transaction(raw_trx);
-
-    trxs_hashes.push_back(trx.getHash());
-    trxs.push_back(std::move(trx));
+  trxs_positions.reserve(raw_trxs.size());
+
+  // Decode and hash transactions in parallel, malformed ones are skipped
+  std::vector<std::optional<Transaction>> decoded_trxs(raw_trxs.size());
+  batch_verifiers_.parallel_for(raw_trxs.size(), c_min_verification_chunk_size, [&](size_t from, size_t to) {
+    for (auto idx = from; idx < to; ++idx) {
+      try {
+        decoded_trxs[idx].emplace(raw_trxs[idx]);
+        decoded_trxs[idx]->getHash();
+      } catch (std::exception const &e) {
+        LOG(log_wr_) << "Unable to decode transaction: " << e.what();
+        results[idx].second = std::string("malformed transaction: ") + e.what();
+      }
+    }
+  });
+  for (size_t idx = 0; idx < decoded_trxs.size(); idx++) {
+    if (auto &trx = decoded_trxs[idx]) {
+      results[idx].first = trx->getHash();
+      trxs_hashes.push_back(trx->getHash());
+      trxs.push_back(std::move(*trx));
+      trxs_positions.push_back(idx);
+    }
+  }
+  if (on_decoded) {
+    on_decoded(trxs_hashes);
   }
 
-  // Get transactions statuses from db
-  DbStorage::MultiGetQuery db_query(db_);
-  db_query.append(DbStorage::Columns::trx_status, trxs_hashes);
-  auto db_trxs_statuses = db_query.execute();
+  // Get transactions statuses from status index, db is read only for possibly finalized transactions
+  auto trxs_statuses = getTransactionsStatuses(trxs_hashes);
 
-  auto write_batch = db_->createWriteBatch();
-  for (size_t idx = 0; idx < db_trxs_statuses.size(); idx++) {
-    auto &trx_raw_status = db_trxs_statuses[idx];
+  // Only transactions never seen before (or evicted from pool) are verified, already known ones are reported
+  std::vector<size_t> unseen_idxs;
+  std::vector<Transaction> unseen_candidates;
+  std::unordered_set<trx_hash_t> batch_hashes;
+  for (size_t idx = 0; idx < trxs_statuses.size(); idx++) {
     const trx_hash_t &trx_hash = trxs_hashes[idx];
+    TransactionStatus trx_status = trxs_statuses[idx];
+    auto &error = results[trxs_positions[idx]].second;
 
-    TransactionStatus trx_status =
-        trx_raw_status.empty() ? TransactionStatus::not_seen : (TransactionStatus) * (uint16_t *)&trx_raw_status[0];
-    // TransactionStatus trx_status = trx_raw_status.empty() ? TransactionStatus::not_seen :
-    // static_cast<TransactionStatus>(*reinterpret_cast<uint16_t*>(&trx_raw_status[0]));
+    if (!batch_hashes.insert(trx_hash).second) {
+      error = "duplicate in batch";
+      continue;
+    }
 
-    LOG(log_dg_) << "Broadcasted transaction " << trx_hash << " received at: " << getCurrentTimeMilliSeconds();
+    LOG(log_dg_) << "Transaction " << trx_hash << " received at: " << getCurrentTimeMilliSeconds();
 
     // Trx status was already saved in db -> it means we already processed this trx
-    // Do not process it again
-    if (trx_status != TransactionStatus::not_seen) {
+    // Do not process it again, unless it was evicted from pool before
+    if (trx_status != TransactionStatus::not_seen && trx_status != TransactionStatus::evicted) {
       switch (trx_status) {
         case TransactionStatus::in_queue_verified:
-          LOG(log_dg_) << "Trx: " << trx_hash << " skipped, seen in verified queue.";
+          error = "in verified queue";
           break;
         case TransactionStatus::in_queue_unverified:
-          LOG(log_dg_) << "Trx: " << trx_hash << " skipped, seen in unverified queue.";
+          error = "in unverified queue";
           break;
         case TransactionStatus::in_block:
-          LOG(log_dg_) << "Trx: " << trx_hash << " skipped, seen in block.";
+          error = "in block";
           break;
         case TransactionStatus::invalid:
-          LOG(log_dg_) << "Trx: " << trx_hash << " skipped, seen but invalid.";
+          error = "already invalid";
           break;
         default:
-          LOG(log_dg_) << "Trx: " << trx_hash << " skipped, unknown trx status saved in db.";
+          error = "unknown";
       }
+      LOG(log_dg_) << "Trx: " << trx_hash << " skipped, " << error;
+      continue;
+    }
+    unseen_idxs.push_back(idx);
+    unseen_candidates.push_back(std::move(trxs[idx]));
+  }
 
+  // Recover senders of the unseen transactions before touching the queue
+  auto verification_results = verifyTransactions(unseen_candidates);
+  unseen_trxs.reserve(unseen_candidates.size());
+
+  auto write_batch = db_->createWriteBatch();
+  StatusUpdates status_updates;
+  for (size_t candidate_idx = 0; candidate_idx < unseen_candidates.size(); candidate_idx++) {
+    auto const idx = unseen_idxs[candidate_idx];
+    const trx_hash_t &trx_hash = trxs_hashes[idx];
+    auto &error = results[trxs_positions[idx]].second;
+
+    if (auto const &valid = verification_results[candidate_idx]; !valid.first) {
+      addTransactionStatusToBatch(write_batch, trx_hash, TransactionStatus::invalid, status_updates);
+      LOG(log_wr_) << " Trx: " << trx_hash << "invalid: " << valid.second;
+      error = valid.second;
       continue;
     }
 
-    const Transaction &trx = trxs[idx];
+    Transaction &trx = unseen_candidates[candidate_idx];
+
+    if (const auto admitted = trx_qu_.checkPoolLimits(trx); !admitted.first) {
+      LOG(log_dg_) << "Trx: " << trx_hash << " rejected by pool: " << admitted.second;
+      error = admitted.second;
+      continue;
+    }
 
     db_->addTransactionToBatch(trx, write_batch);
-    db_->addTransactionStatusToBatch(write_batch, trx_hash, TransactionStatus::in_queue_unverified);
+    addTransactionStatusToBatch(write_batch, trx_hash, TransactionStatus::in_queue_verified, status_updates);
 
-    unseen_trxs.push_back(std::move(trx));
     if (ws_server_) ws_server_->newPendingTransaction(trx_hash);
+    unseen_trxs.push_back(std::move(trx));
   }
 
-  db_->commitWriteBatch(write_batch);
-  trx_qu_.insertUnverifiedTrxs(unseen_trxs);
+  commitWriteBatch_(write_batch, status_updates);
+  markEvictedTransactions_(trx_qu_.insertVerifiedTrxs(unseen_trxs));
+
+  if (broadcast && !unseen_trxs.empty()) {
+    if (auto net = network_.lock(); net && conf_.network.network_transaction_interval == 0) {
+      net->onNewTransactions(std::move(unseen_trxs));
+    }
+  }
 
-  LOG(log_nf_) << raw_trxs.size() << " received txs processed (" << unseen_trxs.size()
-               << " unseen -> inserted into db).";
-  return unseen_trxs.size();
+  return results;
 }
 
 void TransactionManager::verifyQueuedTrxs() {
@@ -219,18 +419,18 @@ void TransactionManager::verifyQueuedTrxs() {
     }
     // mark invalid
     if (!valid.first) {
-      db_->saveTransactionStatus(hash, TransactionStatus::invalid);
+      saveTransactionStatus(hash, TransactionStatus::invalid);
       trx_qu_.removeTransactionFromBuffer(hash);
 
       LOG(log_wr_) << " Trx: " << hash << "invalid: " << valid.second << std::endl;
       continue;
     }
     {
-      auto status = db_->getTransactionStatus(hash);
+      auto status = getTransactionStatus(hash);
       if (status == TransactionStatus::in_queue_unverified) {
-        db_->saveTransactionStatus(hash, TransactionStatus::in_queue_verified);
+        saveTransactionStatus(hash, TransactionStatus::in_queue_verified);
 
-        trx_qu_.addTransactionToVerifiedQueue(hash, item.second);
+        markEvictedTransactions_(trx_qu_.addTransactionToVerifiedQueue(hash, item.second));
       }
     }
   }
@@ -245,6 +445,7 @@ void TransactionManager::start() {
     return;
   }
   trx_qu_.start();
+  batch_verifiers_.start();
   verifiers_.clear();
   for (size_t i = 0; i < num_verifiers_; ++i) {
     LOG(log_nf_) << "Create Transaction verifier ... " << std::endl;
@@ -258,6 +459,7 @@ void TransactionManager::stop() {
     return;
   }
   trx_qu_.stop();
+  batch_verifiers_.stop();
   for (auto &t : verifiers_) {
     t.join();
   }
@@ -271,16 +473,10 @@ std::pair<size_t, size_t> TransactionManager::getTransactionQueueSize() const {
   return trx_qu_.getTransactionQueueSize();
 }
 
-std::vector<taraxa::bytes> TransactionManager::getNewVerifiedTrxSnapShotSerialized() {
+std::vector<Transaction> TransactionManager::getNewVerifiedTrxSnapShot() {
   auto verified_trxs = trx_qu_.getNewVerifiedTrxSnapShot();
-  std::vector<Transaction> vec_trxs;
-  std::copy(verified_trxs.begin(), verified_trxs.end(), std::back_inserter(vec_trxs));
-  sort(vec_trxs.begin(), vec_trxs.end(), trxComp);
-  std::vector<taraxa::bytes> ret;
-  for (auto const &t : vec_trxs) {
-    ret.emplace_back(*t.rlp());
-  }
-  return ret;
+  sort(verified_trxs.begin(), verified_trxs.end(), trxComp);
+  return verified_trxs;
 }
 
 unsigned long TransactionManager::getTransactionCount() const { return trx_count_.load(); }
@@ -297,6 +493,17 @@ std::shared_ptr<std::pair<Transaction, taraxa::bytes>> TransactionManager::getTr
   return tr;
 }
 
+vec_trx_t TransactionManager::filterUnseenTransactions(vec_trx_t const &hashes) const {
+  vec_trx_t unseen;
+  auto statuses = getTransactionsStatuses(hashes);
+  for (size_t idx = 0; idx < hashes.size(); idx++) {
+    if (statuses[idx] == TransactionStatus::not_seen) {
+      unseen.push_back(hashes[idx]);
+    }
+  }
+  return unseen;
+}
+
 // Received block means some trx might be packed by others
 bool TransactionManager::saveBlockTransactionAndDeduplicate(DagBlock const &blk,
                                                             std::vector<Transaction> const &some_trxs) {
@@ -318,7 +525,7 @@ bool TransactionManager::saveBlockTransactionAndDeduplicate(DagBlock const &blk,
   bool all_transactions_saved = true;
   trx_hash_t missing_trx;
   for (auto const &trx : known_trx_hashes) {
-    auto status = db_->getTransactionStatus(trx);
+    auto status = getTransactionStatus(trx);
     if (status == TransactionStatus::not_seen) {
       all_transactions_saved = false;
       missing_trx = trx;
@@ -328,9 +535,10 @@ bool TransactionManager::saveBlockTransactionAndDeduplicate(DagBlock const &blk,
 
   if (all_transactions_saved) {
     auto trx_batch = db_->createWriteBatch();
+    StatusUpdates status_updates;
 
     for (auto const &trx : all_block_trx_hashes) {
-      auto status = db_->getTransactionStatus(trx);
+      auto status = getTransactionStatus(trx);
       if (status != TransactionStatus::in_block) {
         if (status == TransactionStatus::in_queue_unverified) {
           auto valid = verifyTransaction(db_->getTransactionExt(trx)->first);
@@ -341,7 +549,7 @@ bool TransactionManager::saveBlockTransactionAndDeduplicate(DagBlock const &blk,
         }
 
         trx_count_.fetch_add(1);
-        db_->addTransactionStatusToBatch(trx_batch, trx, TransactionStatus::in_block);
+        addTransactionStatusToBatch(trx_batch, trx, TransactionStatus::in_block, status_updates);
       }
     }
 
@@ -349,7 +557,7 @@ bool TransactionManager::saveBlockTransactionAndDeduplicate(DagBlock const &blk,
     auto trx_count = trx_count_.load();
     db_->addStatusFieldToBatch(StatusDbField::TrxCount, trx_count, trx_batch);
 
-    db_->commitWriteBatch(trx_batch);
+    commitWriteBatch_(trx_batch, status_updates);
   } else {
     LOG(log_er_) << " Missing transaction - FAILED block verification " << missing_trx;
   }
@@ -362,7 +570,8 @@ bool TransactionManager::saveBlockTransactionAndDeduplicate(DagBlock const &blk,
 /**
  * This is for block proposer
  * Few steps:
- * 1. get a snapshot (move) of verified queue (lock)
+ * 1. move executable transactions out of verified queue (lock), they are
+ *already ordered by gas price between senders and by nonce within a sender
  *	  now, verified trxs can include (A) unpacked ,(B) packed by other ,(C)
  *old trx that only seen in db
  * 2. write A, B to database, of course C will be rejected (already exist in
@@ -370,46 +579,39 @@ bool TransactionManager::saveBlockTransactionAndDeduplicate(DagBlock const &blk,
  * 3. propose transactions for block A
  * 4. update A, B and C status to seen_in_db
  */
-void TransactionManager::packTrxs(vec_trx_t &to_be_packed_trx, uint16_t max_trx_to_pack) {
+void TransactionManager::packTrxs(vec_trx_t &to_be_packed_trx, uint16_t max_trx_to_pack,
+                                  PendingTransactionPool::SenderFilter const &sender_filter,
+                                  PendingTransactionPool::NonceGetter const &state_nonce) {
   to_be_packed_trx.clear();
-  std::list<Transaction> list_trxs;
 
-  auto verified_trx = trx_qu_.moveVerifiedTrxSnapShot(max_trx_to_pack);
+  std::vector<trx_hash_t> stale_trxs;
+  auto verified_trx = trx_qu_.moveVerifiedTrxSnapShot(max_trx_to_pack, sender_filter, state_nonce, &stale_trxs);
+  markEvictedTransactions_(stale_trxs);
 
   bool changed = false;
   auto trx_batch = db_->createWriteBatch();
+  StatusUpdates status_updates;
   {
-    for (auto const &i : verified_trx) {
-      trx_hash_t const &hash = i.first;
-      Transaction const &trx = i.second;
-      auto status = db_->getTransactionStatus(hash);
+    for (auto const &trx : verified_trx) {
+      trx_hash_t const &hash = trx.getHash();
+      auto status = getTransactionStatus(hash);
       if (status == TransactionStatus::in_queue_verified) {
         // Skip if transaction is already in existing block
-        db_->addTransactionStatusToBatch(trx_batch, hash, TransactionStatus::in_block);
+        addTransactionStatusToBatch(trx_batch, hash, TransactionStatus::in_block, status_updates);
         trx_count_.fetch_add(1);
         changed = true;
         LOG(log_dg_) << "Trx: " << hash << " ready to pack" << std::endl;
         // update transaction_status
-        list_trxs.push_back(trx);
+        to_be_packed_trx.push_back(hash);
       }
     }
 
     if (changed) {
       auto trx_count = trx_count_.load();
       db_->addStatusFieldToBatch(StatusDbField::TrxCount, trx_count, trx_batch);
-      db_->commitWriteBatch(trx_batch);
+      commitWriteBatch_(trx_batch, status_updates);
     }
   }
-
-  if (list_trxs.size() == 0) {
-    return;
-  }
-
-  // sort trx based on sender and nonce
-  list_trxs.sort(trxComp);
-
-  std::transform(list_trxs.begin(), list_trxs.end(), std::back_inserter(to_be_packed_trx),
-                 [](Transaction const &t) { return t.getHash(); });
 }
 
 bool TransactionManager::verifyBlockTransactions(DagBlock const &blk, std::vector<Transaction> const &trxs) {
@@ -5,6 +5,8 @@
 #include "transaction.hpp"
 #include "transaction_queue.hpp"
 #include "transaction_status.hpp"
+#include "transaction_status_index.hpp"
+#include "util/thread_pool.hpp"
 
 namespace taraxa {
 
@@ -32,8 +34,13 @@ class TransactionManager : public std::enable_shared_from_this<TransactionManage
   TransactionManager(FullNodeConfig const &conf, addr_t node_addr, std::shared_ptr<DbStorage> db,
                      logger::Logger log_time);
   explicit TransactionManager(std::shared_ptr<DbStorage> db, addr_t node_addr)
-      : db_(db), conf_(), trx_qu_(node_addr), node_addr_(node_addr) {
+      : db_(db),
+        conf_(),
+        trx_qu_(node_addr, conf_.transaction_pool),
+        trx_status_index_(TransactionStatusIndex::capacityFor(db->getStatusField(StatusDbField::TrxCount))),
+        node_addr_(node_addr) {
     LOG_OBJECTS_CREATE("TRXMGR");
+    loadTransactionStatusIndex_();
   }
   std::shared_ptr<TransactionManager> getShared() {
     try {
@@ -44,7 +51,10 @@ class TransactionManager : public std::enable_shared_from_this<TransactionManage
     }
   }
 
-  virtual ~TransactionManager() { stop(); }
+  virtual ~TransactionManager() {
+    stop();
+    saveTransactionStatusIndex_();
+  }
 
   void start();
   void stop();
@@ -53,8 +63,16 @@ class TransactionManager : public std::enable_shared_from_this<TransactionManage
 
   /**
    * The following function will require a lock for verified qu
+   *
+   * @param to_be_packed_trx executable transactions in packing order (gas price between senders, nonce within sender)
+   * @param max_trx_to_pack max number of transactions to pack, 0 means no limit
+   * @param sender_filter only transactions of senders accepted by filter are packed, others stay in queue
+   * @param state_nonce account nonce of sender in state, transactions after a nonce gap stay in queue and those with
+   *        already used nonce are evicted
    */
-  void packTrxs(vec_trx_t &to_be_packed_trx, uint16_t max_trx_to_pack = 0);
+  void packTrxs(vec_trx_t &to_be_packed_trx, uint16_t max_trx_to_pack = 0,
+                PendingTransactionPool::SenderFilter const &sender_filter = {},
+                PendingTransactionPool::NonceGetter const &state_nonce = {});
   void setVerifyMode(VerifyMode mode) { mode_ = mode; }
 
   /**
@@ -69,24 +87,59 @@ class TransactionManager : public std::enable_shared_from_this<TransactionManage
   std::pair<bool, std::string> insertTransaction(Transaction const &trx, bool verify = true, bool broadcast = true);
 
   /**
-   * @brief Inserts batch of unverified broadcasted transactions to unverified queue and db
+   * @brief Inserts batch of broadcasted transactions asynchronously, they are decoded, verified and inserted on the
+   *        verification thread pool so the network thread does not wait for it
    *
    * @note Some of the transactions might be already processed -> they are not processed and inserted again
    * @param raw_trxs transactions to be processed
-   * @return number of successfully inserted unseen transactions
+   * @param on_decoded called on the verification pool with hashes of well formed transactions before they are
+   *        inserted and broadcasted
+   * @param on_inserted called on the verification pool with number of successfully inserted unseen transactions
    */
-  uint32_t insertBroadcastedTransactions(const std::vector<taraxa::bytes> &raw_trxs);
+  void insertBroadcastedTransactions(std::vector<taraxa::bytes> raw_trxs,
+                                     std::function<void(vec_trx_t const &)> on_decoded = {},
+                                     std::function<void(uint32_t)> on_inserted = {});
+
+  /**
+   * @brief Inserts batch of raw transactions, they are decoded and verified in parallel, written to db in one batch
+   *        and broadcasted in one packet
+   *
+   * @param raw_trxs transactions to be processed
+   * @param broadcast - if set to true, inserted transactions are broadcasted to the network
+   * @param on_decoded called with hashes of well formed transactions before they are inserted
+   * @return per transaction results in the same order as raw_trxs: pair<hash (zero if malformed), ERR message (empty
+   *         if inserted)>
+   */
+  std::vector<std::pair<trx_hash_t, std::string>> insertRawTransactions(
+      const std::vector<taraxa::bytes> &raw_trxs, bool broadcast = true,
+      std::function<void(vec_trx_t const &)> const &on_decoded = {});
 
   std::pair<bool, std::string> verifyTransaction(Transaction const &trx) const;
 
+  /**
+   * @brief Verifies batch of transactions, senders are recovered in parallel chunks on the verification thread pool
+   *
+   * @param trxs transactions to be verified, recovered senders are cached inside of them
+   * @return verification results in the same order as trxs
+   */
+  std::vector<std::pair<bool, std::string>> verifyTransactions(std::vector<Transaction> const &trxs);
+
   std::unordered_map<trx_hash_t, Transaction> getVerifiedTrxSnapShot() const;
-  std::vector<taraxa::bytes> getNewVerifiedTrxSnapShotSerialized();
+  std::vector<Transaction> getNewVerifiedTrxSnapShot();
   std::pair<size_t, size_t> getTransactionQueueSize() const;
 
   // Verify transactions in broadcasted blocks
   bool verifyBlockTransactions(DagBlock const &blk, std::vector<Transaction> const &trxs);
 
   std::shared_ptr<std::pair<Transaction, taraxa::bytes>> getTransaction(trx_hash_t const &hash) const;
+
+  /**
+   * @brief Filters transactions that were never seen by this node, used for requesting announced transactions
+   *
+   * @param hashes
+   * @return hashes of not seen transactions
+   */
+  vec_trx_t filterUnseenTransactions(vec_trx_t const &hashes) const;
   unsigned long getTransactionCount() const;
   // Received block means these trxs are packed by others
 
@@ -102,17 +155,42 @@ class TransactionManager : public std::enable_shared_from_this<TransactionManage
    */
   bool checkQueueOverflow();
 
+  /**
+   * @brief Transaction statuses are read through trx_status_index_, db is used only for transactions possibly seen
+   *        out of this node's queue. All status writes must go through saveTransactionStatus or
+   *        addTransactionStatusToBatch + commitWriteBatch_, the index is updated only after the statuses are committed
+   *        to db
+   */
+  using StatusUpdates = std::vector<std::pair<trx_hash_t, TransactionStatus>>;
+  void loadTransactionStatusIndex_();
+  void saveTransactionStatusIndex_();
+  TransactionStatus getTransactionStatus(trx_hash_t const &hash) const;
+  std::vector<TransactionStatus> getTransactionsStatuses(vec_trx_t const &hashes) const;
+  void saveTransactionStatus(trx_hash_t const &hash, TransactionStatus status);
+  void addTransactionStatusToBatch(DbStorage::BatchPtr const &write_batch, trx_hash_t const &hash,
+                                   TransactionStatus status, StatusUpdates &status_updates);
+  void commitWriteBatch_(DbStorage::BatchPtr const &write_batch, StatusUpdates const &status_updates);
+
+  /**
+   * @brief Marks transactions evicted from pool, skips those that got into block in the meantime
+   */
+  void markEvictedTransactions_(std::vector<trx_hash_t> const &hashes);
+
  private:
   void verifyQueuedTrxs();
   size_t num_verifiers_ = 4;
+  // Minimal number of transactions verified by one thread in batch verification
+  static constexpr size_t c_min_verification_chunk_size = 64;
   addr_t getFullNodeAddress() const;
   VerifyMode mode_ = VerifyMode::normal;
   std::atomic<bool> stopped_ = true;
   std::shared_ptr<DbStorage> db_ = nullptr;
   FullNodeConfig conf_;
   TransactionQueue trx_qu_;
+  TransactionStatusIndex trx_status_index_;
   std::atomic<unsigned long> trx_count_ = 0;
   std::vector<std::thread> verifiers_;
+  util::ThreadPool batch_verifiers_{num_verifiers_, false};
   std::weak_ptr<Network> network_;
   std::shared_ptr<net::WSServer> ws_server_;
   addr_t node_addr_;
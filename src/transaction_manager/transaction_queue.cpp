@@ -1,5 +1,6 @@
 #include "transaction_queue.hpp"
 
+#include <algorithm>
 #include <string>
 #include <utility>
 
@@ -20,26 +21,125 @@ void TransactionQueue::stop() {
   cond_for_unverified_qu_.notify_all();
 }
 
-void TransactionQueue::insert(Transaction const &trx, bool verify) {
-  trx_hash_t hash = trx.getHash();
-  listIter iter;
+TransactionQueue::listIter TransactionQueue::addToBuffer(Transaction const &trx) {
+  auto iter = trx_buffer_.insert(trx_buffer_.end(), trx);
+  assert(iter != trx_buffer_.end());
+  queued_trxs_[trx.getHash()] = iter;
+  buffer_size_bytes_ += iter->memoryUsage();
+  return iter;
+}
 
-  {
-    uLock lock(shared_mutex_for_queued_trxs_);
-    iter = trx_buffer_.insert(trx_buffer_.end(), trx);
-    assert(iter != trx_buffer_.end());
-    queued_trxs_[trx.getHash()] = iter;
+void TransactionQueue::eraseFromBuffer(trx_hash_t const &hash) {
+  auto it = queued_trxs_.find(hash);
+  if (it == queued_trxs_.end()) {
+    return;
+  }
+  buffer_size_bytes_ -= std::min(buffer_size_bytes_, it->second->memoryUsage());
+  trx_buffer_.erase(it->second);
+  queued_trxs_.erase(it);
+}
+
+void TransactionQueue::eraseVerified(trx_hash_t const &hash) {
+  verified_trxs_.erase(hash);
+  pending_pool_.erase(hash);
+  eraseFromBuffer(hash);
+}
+
+bool TransactionQueue::isOverLimits(size_t extra_trxs, size_t extra_bytes) const {
+  if (config_.max_transactions && queued_trxs_.size() + extra_trxs > config_.max_transactions) {
+    return true;
+  }
+  return config_.max_size_mb && buffer_size_bytes_ + extra_bytes > size_t(config_.max_size_mb) * 1024 * 1024;
+}
+
+std::pair<bool, std::string> TransactionQueue::checkPoolLimits(Transaction const &trx) const {
+  sharedLock verified_lock(shared_mutex_for_verified_qu_);
+  sharedLock queued_lock(shared_mutex_for_queued_trxs_);
+
+  auto const sender = PendingTransactionPool::getIndexSender(trx);
+  if (auto same_nonce = pending_pool_.find(sender, trx.getNonce())) {
+    if (trx.getGasPrice() * 100 < same_nonce->second->getGasPrice() * (100 + config_.price_bump_percent)) {
+      return {false, "replacement transaction underpriced"};
+    }
+    return {true, ""};
+  }
+
+  if (config_.max_transactions_per_sender &&
+      pending_pool_.senderSize(sender) >= config_.max_transactions_per_sender) {
+    if (auto tail = pending_pool_.senderTail(sender); !tail || tail->second->getNonce() < trx.getNonce()) {
+      return {false, "sender transactions limit reached"};
+    }
+  }
+
+  if (isOverLimits(1, trx.memoryUsage())) {
+    if (auto candidate = pending_pool_.evictionCandidate();
+        !candidate || candidate->second->getGasPrice() >= trx.getGasPrice()) {
+      return {false, "transaction pool is full"};
+    }
+  }
+  return {true, ""};
+}
+
+std::vector<trx_hash_t> TransactionQueue::makeRoom(Transaction const &trx, bool buffered) {
+  std::vector<trx_hash_t> evicted;
+
+  // Replaced transaction, or sender's highest nonce one if sender is over its limit
+  auto const sender = PendingTransactionPool::getIndexSender(trx);
+  if (auto same_nonce = pending_pool_.find(sender, trx.getNonce())) {
+    evicted.push_back(same_nonce->first);
+  } else if (config_.max_transactions_per_sender &&
+             pending_pool_.senderSize(sender) >= config_.max_transactions_per_sender) {
+    if (auto tail = pending_pool_.senderTail(sender); tail && tail->second->getNonce() > trx.getNonce()) {
+      evicted.push_back(tail->first);
+    }
+  }
+  for (auto const &hash : evicted) {
+    eraseVerified(hash);
   }
+
+  // Cheaper transactions while over limits. Admission was checked by checkPoolLimits before, if the pool changed in
+  // the meantime transaction is still inserted and limits are exceeded until next insertion or packing
+  auto const extra_trxs = buffered ? 0 : 1;
+  auto const extra_bytes = buffered ? 0 : trx.memoryUsage();
+  while (isOverLimits(extra_trxs, extra_bytes)) {
+    auto candidate = pending_pool_.evictionCandidate();
+    if (!candidate || candidate->second->getGasPrice() >= trx.getGasPrice()) {
+      break;
+    }
+    evicted.push_back(candidate->first);
+    eraseVerified(candidate->first);
+  }
+
+  if (!evicted.empty()) {
+    LOG(log_dg_) << "Trx: " << trx.getHash() << " evicted " << evicted.size() << " transactions from pool";
+  }
+  return evicted;
+}
+
+std::vector<trx_hash_t> TransactionQueue::insert(Transaction const &trx, bool verify) {
+  trx_hash_t hash = trx.getHash();
+  std::vector<trx_hash_t> evicted;
+
   if (verify) {
-    uLock lock(shared_mutex_for_verified_qu_);
-    verified_trxs_[trx.getHash()] = iter;
+    uLock verified_lock(shared_mutex_for_verified_qu_);
+    uLock queued_lock(shared_mutex_for_queued_trxs_);
+    evicted = makeRoom(trx, false);
+    auto iter = addToBuffer(trx);
+    verified_trxs_[hash] = iter;
+    pending_pool_.insert(hash, iter);
     new_verified_transactions_ = true;
   } else {
+    listIter iter;
+    {
+      uLock lock(shared_mutex_for_queued_trxs_);
+      iter = addToBuffer(trx);
+    }
     uLock lock(shared_mutex_for_unverified_qu_);
     unverified_hash_qu_.emplace_back(std::make_pair(hash, iter));
     cond_for_unverified_qu_.notify_one();
   }
   LOG(log_nf_) << " Trx: " << hash << " inserted. " << verify << std::endl;
+  return evicted;
 }
 
 void TransactionQueue::insertUnverifiedTrxs(const vector<Transaction> &trxs) {
@@ -51,13 +151,9 @@ void TransactionQueue::insertUnverifiedTrxs(const vector<Transaction> &trxs) {
   iters.reserve(trxs.size());
 
   {
-    listIter iter;
     uLock lock(shared_mutex_for_queued_trxs_);
     for (const auto &trx : trxs) {
-      iter = trx_buffer_.insert(trx_buffer_.end(), trx);
-      assert(iter != trx_buffer_.end());
-      queued_trxs_[trx.getHash()] = iter;
-      iters.push_back(iter);
+      iters.push_back(addToBuffer(trx));
     }
   }
 
@@ -68,6 +164,29 @@ void TransactionQueue::insertUnverifiedTrxs(const vector<Transaction> &trxs) {
   }
 }
 
+std::vector<trx_hash_t> TransactionQueue::insertVerifiedTrxs(const vector<Transaction> &trxs) {
+  std::vector<trx_hash_t> evicted;
+  if (trxs.empty()) {
+    return evicted;
+  }
+
+  uLock verified_lock(shared_mutex_for_verified_qu_);
+  uLock queued_lock(shared_mutex_for_queued_trxs_);
+  for (const auto &trx : trxs) {
+    auto const &hash = trx.getHash();
+    if (queued_trxs_.count(hash)) {
+      continue;
+    }
+    auto trx_evicted = makeRoom(trx, false);
+    evicted.insert(evicted.end(), trx_evicted.begin(), trx_evicted.end());
+    auto iter = addToBuffer(trx);
+    verified_trxs_[hash] = iter;
+    pending_pool_.insert(hash, iter);
+  }
+  new_verified_transactions_ = true;
+  return evicted;
+}
+
 std::pair<trx_hash_t, TransactionQueue::listIter> TransactionQueue::getUnverifiedTransaction() {
   std::pair<trx_hash_t, listIter> item;
   {
@@ -87,14 +206,18 @@ std::pair<trx_hash_t, TransactionQueue::listIter> TransactionQueue::getUnverifie
 
 void TransactionQueue::removeTransactionFromBuffer(trx_hash_t const &hash) {
   uLock lock(shared_mutex_for_queued_trxs_);
-  trx_buffer_.erase(queued_trxs_[hash]);
-  queued_trxs_.erase(hash);
+  eraseFromBuffer(hash);
 }
 
-void TransactionQueue::addTransactionToVerifiedQueue(trx_hash_t const &hash, std::list<Transaction>::iterator iter) {
-  uLock lock(shared_mutex_for_verified_qu_);
+std::vector<trx_hash_t> TransactionQueue::addTransactionToVerifiedQueue(trx_hash_t const &hash,
+                                                                        std::list<Transaction>::iterator iter) {
+  uLock verified_lock(shared_mutex_for_verified_qu_);
+  uLock queued_lock(shared_mutex_for_queued_trxs_);
+  auto evicted = makeRoom(*iter, true);
   verified_trxs_[hash] = iter;
+  pending_pool_.insert(hash, iter);
   new_verified_transactions_ = true;
+  return evicted;
 }
 
 // The caller is responsible for storing the transaction to db!
@@ -113,6 +236,7 @@ std::unordered_map<trx_hash_t, Transaction> TransactionQueue::removeBlockTransac
           {
             upgradeLock locked(lock);
             verified_trxs_.erase(trx);
+            pending_pool_.erase(trx);
           }
         }
       }
@@ -123,8 +247,7 @@ std::unordered_map<trx_hash_t, Transaction> TransactionQueue::removeBlockTransac
     {
       uLock lock(shared_mutex_for_queued_trxs_);
       for (auto const &t : removed_trx) {
-        trx_buffer_.erase(queued_trxs_[t]);
-        queued_trxs_.erase(t);
+        eraseFromBuffer(t);
       }
     }
   }
@@ -169,32 +292,34 @@ std::shared_ptr<Transaction> TransactionQueue::getTransaction(trx_hash_t const &
   return nullptr;
 }
 
-std::unordered_map<trx_hash_t, Transaction> TransactionQueue::moveVerifiedTrxSnapShot(uint16_t max_trx_to_pack) {
-  std::unordered_map<trx_hash_t, Transaction> res;
+std::vector<Transaction> TransactionQueue::moveVerifiedTrxSnapShot(
+    uint16_t max_trx_to_pack, PendingTransactionPool::SenderFilter const &sender_filter,
+    PendingTransactionPool::NonceGetter const &state_nonce, std::vector<trx_hash_t> *dropped) {
+  std::vector<Transaction> res;
+  std::vector<trx_hash_t> moved_hashes;
   {
-    upgradableLock lock(shared_mutex_for_verified_qu_);
-    if (max_trx_to_pack == 0) {
-      for (auto const &trx : verified_trxs_) {
-        res[trx.first] = *(trx.second);
-      }
-      upgradeLock locked(lock);
-      verified_trxs_.clear();
-    } else {
-      auto it = verified_trxs_.begin();
-      uint16_t counter = 0;
-      while (it != verified_trxs_.end() && max_trx_to_pack != counter) {
-        res[it->first] = *(it->second);
-        upgradeLock locked(lock);
-        it = verified_trxs_.erase(it);
-        counter++;
+    uLock lock(shared_mutex_for_verified_qu_);
+    std::vector<PendingTransactionPool::Item> stale_trxs;
+    auto executable_trxs = pending_pool_.popExecutable(max_trx_to_pack, sender_filter, state_nonce, &stale_trxs);
+    res.reserve(executable_trxs.size());
+    moved_hashes.reserve(executable_trxs.size() + stale_trxs.size());
+    for (auto const &[hash, iter] : executable_trxs) {
+      res.push_back(*iter);
+      moved_hashes.push_back(hash);
+      verified_trxs_.erase(hash);
+    }
+    for (auto const &[hash, iter] : stale_trxs) {
+      moved_hashes.push_back(hash);
+      verified_trxs_.erase(hash);
+      if (dropped) {
+        dropped->push_back(hash);
       }
     }
   }
   {
     uLock lock(shared_mutex_for_queued_trxs_);
-    for (auto const &t : res) {
-      trx_buffer_.erase(queued_trxs_[t.first]);
-      queued_trxs_.erase(t.first);
+    for (auto const &hash : moved_hashes) {
+      eraseFromBuffer(hash);
     }
   }
   if (res.size() > 0) {
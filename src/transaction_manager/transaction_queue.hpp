@@ -1,6 +1,7 @@
 #pragma once
 
 #include "config/config.hpp"
+#include "pending_transaction_pool.hpp"
 #include "transaction.hpp"
 
 namespace taraxa {
@@ -13,12 +14,30 @@ class TransactionQueue {
  public:
   enum class VerifyMode : uint8_t { normal, skip_verify_sig };
   using listIter = std::list<Transaction>::iterator;
-  TransactionQueue(addr_t node_addr) { LOG_OBJECTS_CREATE("TRXQU"); }
+  TransactionQueue(addr_t node_addr, TransactionPoolConfig const &config = {}) : config_(config) {
+    LOG_OBJECTS_CREATE("TRXQU");
+  }
   ~TransactionQueue() { stop(); }
 
   void start();
   void stop();
-  void insert(Transaction const &trx, bool verify);
+
+  /**
+   * @brief Checks if transaction can be accepted to the pool without modifying it:
+   *        - transaction with the same sender and nonce is replaced only if gas price is bumped by price_bump_percent
+   *        - sender over max_transactions_per_sender can only replace its transactions with higher nonce
+   *        - full pool accepts transaction only if there is a cheaper one to be evicted
+   *
+   * @return std::pair<bool, std::string> -> pair<OK status, ERR message>
+   */
+  std::pair<bool, std::string> checkPoolLimits(Transaction const &trx) const;
+
+  /**
+   * @brief Inserts transaction, verified transaction might evict replaced or cheaper ones (see checkPoolLimits)
+   *
+   * @return hashes of evicted transactions, caller is responsible for updating their status
+   */
+  std::vector<trx_hash_t> insert(Transaction const &trx, bool verify);
 
   /**
    * @brief Insert batch of unverified transactions at once
@@ -27,12 +46,32 @@ class TransactionQueue {
    */
   void insertUnverifiedTrxs(const vector<Transaction> &trxs);
 
+  /**
+   * @brief Insert batch of already verified transactions at once
+   * @param trxs
+   * @return hashes of evicted transactions, caller is responsible for updating their status
+   */
+  std::vector<trx_hash_t> insertVerifiedTrxs(const vector<Transaction> &trxs);
+
   Transaction top();
   void pop();
   std::pair<trx_hash_t, listIter> getUnverifiedTransaction();
   void removeTransactionFromBuffer(trx_hash_t const &hash);
-  void addTransactionToVerifiedQueue(trx_hash_t const &hash, std::list<Transaction>::iterator);
-  std::unordered_map<trx_hash_t, Transaction> moveVerifiedTrxSnapShot(uint16_t max_trx_to_pack = 0);
+  std::vector<trx_hash_t> addTransactionToVerifiedQueue(trx_hash_t const &hash, std::list<Transaction>::iterator);
+
+  /**
+   * @brief Moves executable verified transactions out of the queue in packing order, see PendingTransactionPool
+   *
+   * @param max_trx_to_pack max number of transactions to move, 0 means no limit
+   * @param sender_filter only transactions of senders accepted by filter are moved (e.g. block proposer shard)
+   * @param state_nonce account nonce of sender in state, used for nonce gap detection
+   * @param dropped if set, hashes of removed transactions with already used nonce are appended to it
+   * @return moved transactions ordered by gas price between senders and by nonce within a sender
+   */
+  std::vector<Transaction> moveVerifiedTrxSnapShot(uint16_t max_trx_to_pack = 0,
+                                                   PendingTransactionPool::SenderFilter const &sender_filter = {},
+                                                   PendingTransactionPool::NonceGetter const &state_nonce = {},
+                                                   std::vector<trx_hash_t> *dropped = nullptr);
   std::unordered_map<trx_hash_t, Transaction> getVerifiedTrxSnapShot() const;
   std::pair<size_t, size_t> getTransactionQueueSize() const;
   std::vector<Transaction> getNewVerifiedTrxSnapShot();
@@ -46,14 +85,26 @@ class TransactionQueue {
   using upgradableLock = boost::upgrade_lock<boost::shared_mutex>;
   using upgradeLock = boost::upgrade_to_unique_lock<boost::shared_mutex>;
   addr_t getFullNodeAddress() const;
+
+  // Must be called with queued trxs lock held
+  listIter addToBuffer(Transaction const &trx);
+  void eraseFromBuffer(trx_hash_t const &hash);
+  // Must be called with verified queue lock and then queued trxs lock held
+  void eraseVerified(trx_hash_t const &hash);
+  bool isOverLimits(size_t extra_trxs, size_t extra_bytes) const;
+  std::vector<trx_hash_t> makeRoom(Transaction const &trx, bool buffered);
+
+  TransactionPoolConfig const config_;
   std::atomic<bool> stopped_ = true;
   bool new_verified_transactions_ = true;
 
   std::list<Transaction> trx_buffer_;
   std::unordered_map<trx_hash_t, listIter> queued_trxs_;  // all trx
+  size_t buffer_size_bytes_ = 0;                          // memory usage of trx_buffer_ transactions
   mutable boost::shared_mutex shared_mutex_for_queued_trxs_;
 
   std::unordered_map<trx_hash_t, listIter> verified_trxs_;
+  PendingTransactionPool pending_pool_;  // index over verified_trxs_
   mutable boost::shared_mutex shared_mutex_for_verified_qu_;
   std::deque<std::pair<trx_hash_t, listIter>> unverified_hash_qu_;
   mutable boost::shared_mutex shared_mutex_for_unverified_qu_;
@@ -7,7 +7,8 @@ enum class TransactionStatus {
   in_block,  // confirmed state, inside of block created by us or someone else
   in_queue_unverified,
   in_queue_verified,
-  not_seen
+  not_seen,
+  evicted  // dropped from full transaction pool, stays in db and might be received again
 };
 
 }
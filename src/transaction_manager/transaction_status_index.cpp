@@ -0,0 +1,33 @@
+#include "transaction_status_index.hpp"
+
+namespace taraxa {
+
+std::optional<TransactionStatus> TransactionStatusIndex::get(trx_hash_t const &hash) const {
+  {
+    auto const &s = shard(hash);
+    sharedLock lock(s.mutex);
+    if (auto it = s.statuses.find(hash); it != s.statuses.end()) {
+      return it->second;
+    }
+  }
+  if (seen_trxs_.contains(hash)) {
+    return std::nullopt;
+  }
+  return TransactionStatus::not_seen;
+}
+
+void TransactionStatusIndex::update(trx_hash_t const &hash, TransactionStatus status) {
+  // Insert into filter first, so that there is no moment when transaction is in neither of them
+  if (status != TransactionStatus::not_seen) {
+    seen_trxs_.insert(hash);
+  }
+  auto &s = shard(hash);
+  uLock lock(s.mutex);
+  if (isOutOfQueue(status) || status == TransactionStatus::not_seen) {
+    s.statuses.erase(hash);
+  } else {
+    s.statuses[hash] = status;
+  }
+}
+
+}  // namespace taraxa
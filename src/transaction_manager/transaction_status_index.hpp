@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "boost/thread.hpp"
+#include "common/types.hpp"
+#include "transaction_status.hpp"
+#include "util/bloom_filter.hpp"
+
+namespace taraxa {
+
+/**
+ * In-memory index in front of trx_status db column
+ * 1. Concurrent map with statuses of transactions that are still in queue (in_queue_unverified, in_queue_verified)
+ * 2. Bloom filter of all transactions with status in db, those that are not in the map are read from db only when the
+ *    filter reports them as present
+ *
+ * Index is updated together with each db status write, then a transaction that is neither in the map nor in the
+ * filter is not_seen without db read. Only the filter is persisted (serialize on shutdown, load on startup), so
+ * statuses written before startup are always read from db.
+ */
+class TransactionStatusIndex {
+ public:
+  static constexpr size_t c_default_capacity = 10'000'000;
+
+  /**
+   * @param expected_trxs number of transactions the bloom filter is sized for, above it the false positive rate
+   *                      (hence db reads) grows, results stay correct
+   */
+  explicit TransactionStatusIndex(size_t expected_trxs = c_default_capacity, double fp_rate = 0.001)
+      : seen_trxs_(expected_trxs, fp_rate) {}
+
+  /**
+   * @return status, or std::nullopt if transaction might have status in db and db must be read
+   */
+  std::optional<TransactionStatus> get(trx_hash_t const &hash) const;
+  void update(trx_hash_t const &hash, TransactionStatus status);
+
+  std::string serialize() const { return seen_trxs_.serialize(); }
+
+  /**
+   * @brief Loads serialized filter, must be called before any update
+   *
+   * @return false if index was serialized with different capacity
+   */
+  bool load(std::string const &data) { return seen_trxs_.deserialize(data); }
+
+  /**
+   * @return capacity for number of known transactions, doubled from default so that it changes (and index has to be
+   *         rebuilt) rarely
+   */
+  static size_t capacityFor(uint64_t known_trxs) {
+    size_t capacity = c_default_capacity;
+    while (capacity < 2 * known_trxs) {
+      capacity *= 2;
+    }
+    return capacity;
+  }
+
+  static bool isOutOfQueue(TransactionStatus status) {
+    return status == TransactionStatus::in_block || status == TransactionStatus::invalid ||
+           status == TransactionStatus::evicted;
+  }
+
+ private:
+  using uLock = boost::unique_lock<boost::shared_mutex>;
+  using sharedLock = boost::shared_lock<boost::shared_mutex>;
+
+  struct Shard {
+    std::unordered_map<trx_hash_t, TransactionStatus> statuses;
+    mutable boost::shared_mutex mutex;
+  };
+  static constexpr size_t c_shards_count = 16;
+  Shard &shard(trx_hash_t const &hash) { return shards_[hash[0] % c_shards_count]; }
+  Shard const &shard(trx_hash_t const &hash) const { return shards_[hash[0] % c_shards_count]; }
+
+  std::array<Shard, c_shards_count> shards_;
+  util::BloomFilter seen_trxs_;
+};
+
+}  // namespace taraxa
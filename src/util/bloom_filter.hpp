@@ -0,0 +1,131 @@
+#pragma once
+
+#include <libdevcore/FixedHash.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace taraxa::util {
+
+/**
+ * Bloom filter over uniformly distributed fixed size hashes (transaction, block, vote hashes...)
+ *
+ * Bits are atomic words, so inserts and lookups are lock-free and may run concurrently. Item positions are derived
+ * from the hash bytes (double hashing), all bytes are mixed into the seeds so that structured hashes (e.g. with
+ * zero prefix) do not collide.
+ */
+class BloomFilter {
+ public:
+  /**
+   * @param expected_items number of items after which false positive rate reaches fp_rate
+   * @param fp_rate target false positive rate
+   */
+  BloomFilter(size_t expected_items, double fp_rate) {
+    expected_items = std::max<size_t>(expected_items, 1);
+    auto bits = -double(expected_items) * std::log(fp_rate) / (std::log(2.0) * std::log(2.0));
+    words_count_ = std::max<size_t>((size_t(bits) + 63) / 64, 1);
+    hashes_count_ = std::max<size_t>(size_t(std::round(double(words_count_ * 64) / expected_items * std::log(2.0))), 1);
+    words_.reset(new std::atomic<uint64_t>[words_count_]);
+    clear();
+  }
+
+  BloomFilter(BloomFilter const &) = delete;
+  BloomFilter &operator=(BloomFilter const &) = delete;
+
+  template <unsigned N>
+  void insert(dev::FixedHash<N> const &hash) {
+    static_assert(N >= 16);
+    auto [h1, h2] = seeds(hash);
+    for (size_t i = 0; i < hashes_count_; ++i) {
+      auto bit = (h1 + i * h2) % (words_count_ * 64);
+      words_[bit / 64].fetch_or(uint64_t(1) << (bit % 64), std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @return false if hash was definitely not inserted
+   */
+  template <unsigned N>
+  bool contains(dev::FixedHash<N> const &hash) const {
+    static_assert(N >= 16);
+    auto [h1, h2] = seeds(hash);
+    for (size_t i = 0; i < hashes_count_; ++i) {
+      auto bit = (h1 + i * h2) % (words_count_ * 64);
+      if (!(words_[bit / 64].load(std::memory_order_relaxed) & (uint64_t(1) << (bit % 64)))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void clear() {
+    for (size_t i = 0; i < words_count_; ++i) {
+      words_[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  size_t sizeInBytes() const { return words_count_ * sizeof(uint64_t); }
+
+  /**
+   * @return bits in native byte order, concurrent inserts might or might not be included
+   */
+  std::string serialize() const {
+    std::string res(sizeInBytes(), '\0');
+    for (size_t i = 0; i < words_count_; ++i) {
+      auto word = words_[i].load(std::memory_order_relaxed);
+      std::memcpy(res.data() + i * sizeof(word), &word, sizeof(word));
+    }
+    return res;
+  }
+
+  /**
+   * @brief Replaces bits with serialized ones
+   *
+   * @return false if data was serialized by filter of different size, the filter is not changed then
+   */
+  bool deserialize(std::string const &data) {
+    if (data.size() != sizeInBytes()) {
+      return false;
+    }
+    for (size_t i = 0; i < words_count_; ++i) {
+      uint64_t word;
+      std::memcpy(&word, data.data() + i * sizeof(word), sizeof(word));
+      words_[i].store(word, std::memory_order_relaxed);
+    }
+    return true;
+  }
+
+ private:
+  // splitmix64 finalizer
+  static uint64_t mix(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+
+  template <unsigned N>
+  static std::pair<uint64_t, uint64_t> seeds(dev::FixedHash<N> const &hash) {
+    uint64_t h1 = 0, h2 = 0x9e3779b97f4a7c15ULL;
+    for (size_t offset = 0; offset < N; offset += sizeof(uint64_t)) {
+      uint64_t word = 0;
+      std::memcpy(&word, hash.data() + offset, std::min(sizeof(word), N - offset));
+      h1 = mix(h1 ^ word);
+      h2 = mix(h2 + word);
+    }
+    // Odd step so that all positions are visited for power of 2 sizes as well
+    return {h1, h2 | 1};
+  }
+
+  size_t words_count_ = 0;
+  size_t hashes_count_ = 0;
+  std::unique_ptr<std::atomic<uint64_t>[]> words_;
+};
+
+}  // namespace taraxa::util
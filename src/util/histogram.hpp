@@ -0,0 +1,58 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace taraxa::util {
+
+/**
+ * Histogram of non-negative values with fixed exponential bucket bounds. Observations are lock-free, snapshot taken
+ * concurrently with observations might be off by the observations in flight.
+ */
+class Histogram {
+ public:
+  // Upper bounds of buckets, the last bucket holds values above the last bound
+  static constexpr std::array<uint64_t, 16> c_bounds = {1,   2,    5,    10,   20,    50,    100,   200,
+                                                         500, 1000, 2000, 5000, 10000, 20000, 50000, 100000};
+
+  struct Snapshot {
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+    // Number of values in each bucket, not cumulative
+    std::vector<uint64_t> buckets;
+  };
+
+  void observe(uint64_t value) {
+    auto const bucket = std::distance(c_bounds.begin(), std::lower_bound(c_bounds.begin(), c_bounds.end(), value));
+    buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+    for (auto max = max_.load(std::memory_order_relaxed);
+         max < value && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed);) {
+    }
+  }
+
+  Snapshot snapshot() const {
+    Snapshot ret;
+    ret.count = count_.load(std::memory_order_relaxed);
+    ret.sum = sum_.load(std::memory_order_relaxed);
+    ret.max = max_.load(std::memory_order_relaxed);
+    for (auto const &bucket : buckets_) {
+      ret.buckets.push_back(bucket.load(std::memory_order_relaxed));
+    }
+    return ret;
+  }
+
+ private:
+  std::array<std::atomic<uint64_t>, c_bounds.size() + 1> buckets_ = {};
+  std::atomic<uint64_t> count_ = 0;
+  std::atomic<uint64_t> sum_ = 0;
+  std::atomic<uint64_t> max_ = 0;
+};
+
+}  // namespace taraxa::util
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "util/bloom_filter.hpp"
+
+namespace taraxa::util {
+
+/**
+ * Bloom filter with expiration. Items are inserted into the current generation and expire together with it: when the
+ * current generation is full or older than generation lifetime, the oldest generation is cleared and becomes current.
+ *
+ * Inserts and lookups are lock-free, only rotation takes a lock. Lookup racing with rotation might miss an item of the
+ * cleared generation, same as if it expired a moment earlier.
+ */
+class RollingBloomFilter {
+ public:
+  /**
+   * @param capacity number of the most recent items that are always kept
+   * @param fp_rate target false positive rate of lookups
+   * @param generation_lifetime max age of the current generation, 0 means that generations rotate only when full
+   * @param generations number of generations, more generations give finer expiration for more memory
+   */
+  RollingBloomFilter(size_t capacity, double fp_rate,
+                     std::chrono::milliseconds generation_lifetime = std::chrono::milliseconds::zero(),
+                     size_t generations = 4)
+      : items_per_generation_(std::max<size_t>(capacity / (std::max<size_t>(generations, 2) - 1), 1)),
+        generation_lifetime_(generation_lifetime) {
+    generations = std::max<size_t>(generations, 2);
+    // Lookup checks all generations, false positive rates add up
+    for (size_t i = 0; i < generations; ++i) {
+      generations_.emplace_back(std::make_unique<BloomFilter>(items_per_generation_, fp_rate / generations));
+    }
+    current_since_ms_ = nowMs();
+  }
+
+  RollingBloomFilter(RollingBloomFilter const &) = delete;
+  RollingBloomFilter &operator=(RollingBloomFilter const &) = delete;
+
+  template <unsigned N>
+  void insert(dev::FixedHash<N> const &hash) {
+    if (current_items_.fetch_add(1, std::memory_order_relaxed) >= items_per_generation_ || isCurrentExpired()) {
+      rotate();
+    }
+    generations_[current_.load(std::memory_order_acquire)]->insert(hash);
+  }
+
+  /**
+   * @return false if hash was definitely not inserted or already expired
+   */
+  template <unsigned N>
+  bool contains(dev::FixedHash<N> const &hash) const {
+    for (auto const &generation : generations_) {
+      if (generation->contains(hash)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void clear() {
+    std::unique_lock lock(rotation_mutex_);
+    for (auto &generation : generations_) {
+      generation->clear();
+    }
+    current_items_.store(0, std::memory_order_relaxed);
+    current_since_ms_.store(nowMs(), std::memory_order_relaxed);
+  }
+
+  size_t sizeInBytes() const { return generations_.size() * generations_.front()->sizeInBytes(); }
+
+ private:
+  static int64_t nowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  bool isCurrentExpired() const {
+    return generation_lifetime_.count() > 0 &&
+           nowMs() - current_since_ms_.load(std::memory_order_relaxed) > generation_lifetime_.count();
+  }
+
+  void rotate() {
+    std::unique_lock lock(rotation_mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+      // Other thread is rotating
+      return;
+    }
+    // Concurrent inserts might have triggered rotation that is already done
+    if (current_items_.load(std::memory_order_relaxed) < items_per_generation_ && !isCurrentExpired()) {
+      return;
+    }
+    auto next = (current_.load(std::memory_order_relaxed) + 1) % generations_.size();
+    generations_[next]->clear();
+    current_items_.store(0, std::memory_order_relaxed);
+    current_since_ms_.store(nowMs(), std::memory_order_relaxed);
+    current_.store(next, std::memory_order_release);
+  }
+
+  size_t const items_per_generation_;
+  std::chrono::milliseconds const generation_lifetime_;
+  std::vector<std::unique_ptr<BloomFilter>> generations_;
+  std::atomic<size_t> current_ = 0;
+  std::atomic<size_t> current_items_ = 0;
+  std::atomic<int64_t> current_since_ms_ = 0;
+  std::mutex rotation_mutex_;
+};
+
+}  // namespace taraxa::util
@@ -1,5 +1,9 @@
 #include "thread_pool.hpp"
 
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+
 namespace taraxa::util {
 
 ThreadPool::ThreadPool(size_t num_threads, bool _start)
@@ -70,6 +74,72 @@ void ThreadPool::post_loop(Periodicity const &periodicity, std::function<void()>
   });
 }
 
+void ThreadPool::parallel_for(size_t size, size_t min_chunk_size,
+                              std::function<void(size_t from, size_t to)> const &action) {
+  if (!size) {
+    return;
+  }
+  auto chunk_size = std::max(min_chunk_size, size / threads_.capacity() + 1);
+  auto chunks_count = (size + chunk_size - 1) / chunk_size;
+  // Pool state is not checked, helpers posted to a stopped pool just never claim a chunk. Checking it would block
+  // parallel_for called from a pool task while the pool is being stopped
+  if (chunks_count == 1) {
+    action(0, size);
+    return;
+  }
+
+  struct State {
+    std::function<void(size_t, size_t)> const *action;
+    size_t size, chunk_size, chunks_count;
+    std::atomic<size_t> next_chunk = 0;
+    size_t done_chunks = 0;
+    std::exception_ptr exception;
+    std::mutex mu;
+    std::condition_variable cv;
+
+    // Returns false when there is no chunk left to claim. Exceptions are caught here, so that a throwing chunk can
+    // neither escape the pool thread nor let the caller return while other chunks still use the action
+    bool processChunk() {
+      auto chunk = next_chunk.fetch_add(1);
+      if (chunk >= chunks_count) {
+        return false;
+      }
+      auto from = chunk * chunk_size;
+      std::exception_ptr chunk_exception;
+      try {
+        (*action)(from, std::min(from + chunk_size, size));
+      } catch (...) {
+        chunk_exception = std::current_exception();
+      }
+      std::unique_lock l(mu);
+      if (chunk_exception && !exception) {
+        exception = chunk_exception;
+      }
+      if (++done_chunks == chunks_count) {
+        cv.notify_all();
+      }
+      return true;
+    }
+  };
+  auto state = std::make_shared<State>();
+  state->action = &action;
+  state->size = size;
+  state->chunk_size = chunk_size;
+  state->chunks_count = chunks_count;
+
+  // Helpers that start after all chunks are claimed return without touching the action
+  for (size_t i = 1; i < chunks_count; ++i) {
+    post([state] { state->processChunk(); });
+  }
+  while (state->processChunk()) {
+  }
+  std::unique_lock l(state->mu);
+  state->cv.wait(l, [&] { return state->done_chunks == state->chunks_count; });
+  if (state->exception) {
+    std::rethrow_exception(state->exception);
+  }
+}
+
 ThreadPool::~ThreadPool() { stop(); }
 
 }  // namespace taraxa::util
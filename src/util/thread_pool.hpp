@@ -43,6 +43,15 @@ class ThreadPool : std::enable_shared_from_this<ThreadPool> {
     uint64_t period_ms = 0, delay_ms = period_ms;
   };
   void post_loop(Periodicity const &periodicity, std::function<void()> action);
+
+  /**
+   * @brief Runs action over [0, size) split into chunks of at least min_chunk_size items. Calling thread takes part
+   *        in the work, so the call completes even when the pool is stopped or busy. It returns only after all chunks
+   *        are done, the first exception thrown by action is rethrown then
+   *
+   * @param action processes items in range [from, to)
+   */
+  void parallel_for(size_t size, size_t min_chunk_size, std::function<void(size_t from, size_t to)> const &action);
 };
 
 }  // namespace taraxa::util
\ No newline at end of file
@@ -108,6 +108,41 @@ TEST_F(CryptoTest, vrf_sortition) {
   EXPECT_EQ(sortition, sortition3);
 }
 
+TEST_F(CryptoTest, vrf_sortition_speak_bound) {
+  vrf_sk_t sk(
+      "0b6627a6680e01cea3d9f36fa797f7f34e8869c3a526d9ed63ed8170e35542aad05dc12c"
+      "1df1edc9f3367fba550b7971fc2de6c5998d8784051c5be69abc9644");
+  for (uint64_t round = 1; round <= 50; round++) {
+    VrfPbftMsg msg(PbftVoteTypes::soft_vote_type, round, 2, 0);
+    VrfPbftSortition sortition(sk, msg);
+    for (auto [threshold, dpos_total_votes_count] :
+         std::vector<std::pair<size_t, size_t>>{{1, 10}, {5, 10}, {10, 10}, {20, 10}, {3, 1000}, {999, 1000}}) {
+      uint1024_t left = (uint1024_t)((uint512_t)sortition.output) * dpos_total_votes_count;
+      uint1024_t right = (uint1024_t)VrfPbftSortition::max512bits * threshold;
+      EXPECT_EQ(sortition.canSpeak(threshold, dpos_total_votes_count), left <= right);
+    }
+  }
+}
+
+TEST_F(CryptoTest, vrf_verify_cached) {
+  vrf_sk_t sk(
+      "0b6627a6680e01cea3d9f36fa797f7f34e8869c3a526d9ed63ed8170e35542aad05dc12c"
+      "1df1edc9f3367fba550b7971fc2de6c5998d8784051c5be69abc9644");
+  VrfPbftMsg msg(PbftVoteTypes::cert_vote_type, 2, 3, 0);
+  VrfPbftSortition sortition(sk, msg);
+  auto const output = sortition.output;
+
+  // Verified twice, second time from cache
+  VrfPbftSortition sortition2(sortition.getRlpBytes());
+  EXPECT_TRUE(sortition2.verify());
+  EXPECT_EQ(sortition2.output, output);
+
+  // Cached proof is not valid for another message
+  auto sortition3 = sortition2;
+  sortition3.pbft_msg.round = 3;
+  EXPECT_FALSE(sortition3.verify());
+}
+
 TEST_F(CryptoTest, vdf_sortition) {
   vdf_sortition::VdfConfig vdf_config(0xffff, 0xe665, 5, 10, 10, 1500);
   vrf_sk_t sk(
@@ -2,10 +2,12 @@
 
 #include <libdevcore/TrieHash.h>
 
+#include <future>
 #include <optional>
 #include <vector>
 
 #include "chain/chain_config.hpp"
+#include "chain/state_call_pool.hpp"
 #include "util_test/gtest.hpp"
 
 namespace taraxa::final_chain {
@@ -130,6 +132,52 @@ TEST_F(FinalChainTest, genesis_balances) {
   init();
 }
 
+TEST_F(FinalChainTest, batch_state_queries) {
+  cfg.state.dpos = nullopt;
+  cfg.state.genesis_balances = {};
+  vector<addr_t> addrs;
+  for (size_t i = 0; i < 10; ++i) {
+    cfg.state.genesis_balances[addrs.emplace_back(addr_t::random())] = 1000 * (i + 1);
+  }
+  init();
+  addrs.push_back(addr_t::random());
+  // Part of accounts is served from the cache
+  SUT->get_account(addrs[0]);
+  SUT->get_account(addrs[5]);
+  auto accounts = SUT->get_accounts(addrs);
+  ASSERT_EQ(accounts.size(), addrs.size());
+  for (size_t i = 0; i < 10; ++i) {
+    ASSERT_TRUE(accounts[i]);
+    EXPECT_EQ(accounts[i]->Balance, cfg.state.effective_genesis_balance(addrs[i]));
+  }
+  EXPECT_FALSE(accounts.back());
+  EXPECT_EQ(SUT->get_accounts(addrs, 0).size(), addrs.size());
+  EXPECT_EQ(SUT->get_account_storage(addrs[0], {1, 2, 3}), (vector<u256>{0, 0, 0}));
+}
+
+TEST_F(FinalChainTest, state_call_pool) {
+  init();
+  shared_ptr<FinalChain> final_chain(SUT.get(), [](auto) {});
+  state_api::EVMTransaction const trx{addr_t::random(), 0, addr_t::random(), 0, 0, 0, {}};
+  state_api::ExecutionOptions const opts{true, true};
+  {
+    StateCallPool pool(final_chain, {2, 1024, 100000, 0});
+    vector<future<state_api::ExecutionResult>> results;
+    for (size_t i = 0; i < 16; ++i) {
+      results.push_back(async(launch::async, [&] { return pool.call(trx, nullopt, opts); }));
+    }
+    for (auto& result : results) {
+      auto const res = result.get();
+      EXPECT_EQ(res.ConsensusErr, "");
+      EXPECT_EQ(res.GasUsed, 21000);
+    }
+  }
+  // Gas is capped below intrinsic gas of transaction
+  StateCallPool pool(final_chain, {1, 1024, 1000, 0});
+  auto const res = pool.call(trx, 0, opts);
+  EXPECT_FALSE(res.ConsensusErr.empty() && res.CodeErr.empty());
+}
+
 TEST_F(FinalChainTest, contract) {
   auto sender_keys = KeyPair::create();
   auto const& addr = sender_keys.address();
@@ -271,6 +319,145 @@ TEST_F(FinalChainTest, coin_transfers) {
   });
 }
 
+TEST_F(FinalChainTest, state_db_behind_is_replayed) {
+  auto const sender = KeyPair::create();
+  auto const receiver = addr_t::random();
+  cfg.state.genesis_balances = {};
+  cfg.state.genesis_balances[sender.address()] = 1000000;
+  cfg.state.dpos = nullopt;
+  init();
+  constexpr auto TRX_GAS = 100000;
+  advance({{100, 0, TRX_GAS, receiver, {}, 0, sender.secret()}});
+  // Block is committed to main db, its state is not
+  {
+    auto batch = db->createWriteBatch();
+    SUT->advance(batch, addr_t::random(), 1, {{200, 0, TRX_GAS, receiver, {}, 1, sender.secret()}});
+    db->commitWriteBatch(batch);
+  }
+  ++expected_blk_num;
+  expected_balances[sender.address()] -= 200;
+  expected_balances[receiver] += 200;
+  SUT = nullptr;
+  SUT = NewFinalChain(db, cfg);
+  EXPECT_EQ(SUT->get_last_block()->number(), 2);
+  EXPECT_EQ(SUT->get_account(receiver)->Balance, 300);
+  advance({{300, 0, TRX_GAS, receiver, {}, 2, sender.secret()}});
+  EXPECT_EQ(SUT->get_account(receiver)->Balance, 600);
+}
+
+TEST_F(FinalChainTest, state_db_ahead_is_restored_from_checkpoint) {
+  auto const sender = KeyPair::create();
+  auto const receiver = addr_t::random();
+  cfg.state.genesis_balances = {};
+  cfg.state.genesis_balances[sender.address()] = 1000000;
+  cfg.state.dpos = nullopt;
+  init();
+  constexpr auto TRX_GAS = 100000;
+  advance({{100, 0, TRX_GAS, receiver, {}, 0, sender.secret()}});
+  SUT->checkpoint_state();
+  advance({{200, 0, TRX_GAS, receiver, {}, 1, sender.secret()}});
+  // State of the block is committed while main db write is lost, like on OS crash before main db sync
+  {
+    auto batch = db->createWriteBatch();
+    SUT->advance(batch, addr_t::random(), 1, {{1000, 0, TRX_GAS, receiver, {}, 2, sender.secret()}});
+    SUT->advance_confirm();
+  }
+  SUT = nullptr;
+  // State db is restored at block 1 and block 2 is executed again
+  SUT = NewFinalChain(db, cfg);
+  EXPECT_FALSE(fs::exists(db->stateDbCheckpointPath()));
+  EXPECT_EQ(SUT->get_last_block()->number(), 2);
+  EXPECT_EQ(SUT->get_account(receiver)->Balance, 300);
+  advance({{300, 0, TRX_GAS, receiver, {}, 2, sender.secret()}});
+  EXPECT_EQ(SUT->get_account(receiver)->Balance, 600);
+
+  // Without checkpoint behind the last block state db ahead of it can't be restored
+  {
+    auto batch = db->createWriteBatch();
+    SUT->advance(batch, addr_t::random(), 1, {});
+    SUT->advance_confirm();
+  }
+  SUT = nullptr;
+  EXPECT_THROW(NewFinalChain(db, cfg), std::runtime_error);
+}
+
+TEST_F(FinalChainTest, log_index) {
+  auto const sk = KeyPair::create().secret();
+  auto const addr1 = addr_t::random(), addr2 = addr_t::random();
+  auto const topic = h256::random();
+  BlockNumber const last_blk_n = LogIndex::c_section_size + 10;
+  LogIndex log_index(db, 0);
+  for (BlockNumber blk_n = 1; blk_n <= last_blk_n; ++blk_n) {
+    Transactions trxs;
+    vector<state_api::ExecutionResult> results;
+    // Every 100th block has a log, every 200th is emitted by addr1
+    if (blk_n % 100 == 0) {
+      trxs.emplace_back(0, 0, 0, addr_t::random(), bytes(), blk_n, sk);
+      results.emplace_back().Logs.push_back({blk_n % 200 ? addr2 : addr1, {topic, h256(blk_n)}, bytes{1, 2, 3}});
+    }
+    auto batch = db->createWriteBatch();
+    log_index.append(batch, blk_n, h256(blk_n), trxs, results);
+    db->commitWriteBatch(batch);
+    log_index.confirm();
+  }
+  auto check = [&](LogIndex const& index) {
+    EXPECT_EQ(index.query({0, last_blk_n}).size(), last_blk_n / 100);
+    EXPECT_EQ(index.query({0, last_blk_n, {addr1}}).size(), last_blk_n / 200);
+    EXPECT_EQ(index.query({0, last_blk_n, {addr1, addr2}, {{topic}}}).size(), last_blk_n / 100);
+    EXPECT_EQ(index.query({0, last_blk_n, {}, {{h256(4000)}}}).size(), 0);
+    EXPECT_EQ(index.query({1000, 1099}).size(), 1);
+    // Sealed and current sections
+    for (BlockNumber blk_n : {4000, 4100}) {
+      auto logs = index.query({0, last_blk_n, {}, {{}, {h256(blk_n)}}});
+      ASSERT_EQ(logs.size(), 1);
+      EXPECT_EQ(logs[0].blk_n, blk_n);
+      EXPECT_EQ(logs[0].blk_hash, h256(blk_n));
+      EXPECT_EQ(logs[0].entry.address, blk_n % 200 ? addr2 : addr1);
+      EXPECT_EQ(logs[0].entry.data, (bytes{1, 2, 3}));
+    }
+  };
+  check(log_index);
+  // Current section is restored from db
+  check(LogIndex(db, last_blk_n));
+}
+
+TEST_F(FinalChainTest, state_cache) {
+  StateCache cache({1, 2});
+  size_t loads = 0;
+  auto get = [&](BlockNumber blk_n, string key) {
+    return cache.get<u256>(blk_n, key, [&] {
+      ++loads;
+      return u256(blk_n);
+    });
+  };
+  EXPECT_EQ(get(1, "a"), 1);
+  EXPECT_EQ(get(1, "a"), 1);
+  EXPECT_EQ(get(2, "a"), 2);
+  EXPECT_EQ(loads, 2);
+  EXPECT_EQ(cache.stats().hits, 1);
+  EXPECT_EQ(cache.stats().misses, 2);
+  EXPECT_EQ(cache.stats().entries, 2);
+
+  // Only the 2 most recent blocks are kept
+  cache.onNewBlock(3);
+  EXPECT_EQ(cache.stats().entries, 1);
+  EXPECT_EQ(get(2, "a"), 2);
+  EXPECT_EQ(get(1, "a"), 1);
+  EXPECT_EQ(loads, 3);
+  EXPECT_EQ(cache.stats().entries, 1);
+
+  // Limit of 1MB drops older blocks first
+  for (size_t i = 0; i < 100000; ++i) {
+    get(3, to_string(i));
+  }
+  EXPECT_LE(cache.stats().size_bytes, 1024 * 1024);
+  loads = 0;
+  get(2, "a");
+  EXPECT_EQ(loads, 1);
+  get(3, "0");
+  EXPECT_EQ(loads, 1);
+}
+
 }  // namespace taraxa::final_chain
 
 TARAXA_TEST_MAIN({})
@@ -412,12 +412,21 @@ TEST_F(FullNodeTest, db_test) {
     Vote vote(g_secret, vrf_sortition, voted_pbft_block_hash);
     next_votes.emplace_back(vote);
   }
+  // Votes are added to the ones saved for the round before
   batch = db.createWriteBatch();
   db.addNextVotesToBatch(round, next_votes, batch);
   db.commitWriteBatch(batch);
   next_votes_from_db = db.getNextVotes(round);
+  EXPECT_EQ(next_votes_from_db.size(), 5);
+  // Replaced in one batch
+  batch = db.createWriteBatch();
+  db.removeNextVotesToBatch(round, batch);
+  db.addNextVotesToBatch(round, next_votes, batch);
+  db.commitWriteBatch(batch);
+  next_votes_from_db = db.getNextVotes(round);
   EXPECT_EQ(next_votes.size(), next_votes_from_db.size());
   EXPECT_EQ(next_votes_from_db.size(), 2);
+  EXPECT_TRUE(db.getNextVotes(round + 1).empty());
   batch = db.createWriteBatch();
   db.removeNextVotesToBatch(round, batch);
   db.commitWriteBatch(batch);
@@ -1453,6 +1462,184 @@ TEST_F(FullNodeTest, transfer_to_self) {
   EXPECT_EQ(bal.first, initial_bal.first);
 }
 
+// Executor prepares next periods while the previous ones are executed. Transaction repeated in DAG blocks of
+// consecutive periods must be executed only in the first of them, same as when periods are executed one by one
+TEST_F(FullNodeTest, executor_pipeline) {
+  auto node_cfg = make_node_cfgs(1).front();
+  auto const sk = dev::Secret(node_cfg.node_secret);
+  auto const node_addr = dev::toAddress(sk);
+
+  std::vector<addr_t> receivers;
+  std::vector<Transaction> trxs;
+  for (uint64_t nonce = 0; nonce < 7; ++nonce) {
+    trxs.emplace_back(nonce, 1, 0, 100000, bytes(), sk, receivers.emplace_back(addr_t::random()));
+  }
+  // Each period repeats the last transaction of the previous one
+  std::vector<std::vector<size_t>> periods_trxs{{0, 1, 2}, {2, 3, 4}, {4, 5}, {5, 6}};
+  std::vector<PbftBlock> pbft_blocks;
+  std::vector<DagBlock> dag_blocks;
+  auto pivot = node_cfg.chain.dag_genesis_block.getHash();
+  auto prev_pbft_hash = blk_hash_t(0);
+  for (uint64_t period = 1; period <= periods_trxs.size(); ++period) {
+    vec_trx_t hashes;
+    for (auto idx : periods_trxs[period - 1]) {
+      hashes.push_back(trxs[idx].getHash());
+    }
+    pivot = dag_blocks.emplace_back(pivot, period, vec_blk_t{}, hashes, sk).getHash();
+    prev_pbft_hash = pbft_blocks.emplace_back(prev_pbft_hash, pivot, period, node_addr, sk).getBlockHash();
+  }
+
+  auto run = [&](bool queued) {
+    FullNode::Handle node(node_cfg);
+    auto const &db = node->getDB();
+    for (auto const &trx : trxs) {
+      db->saveTransaction(trx);
+    }
+    for (size_t i = 0; i < pbft_blocks.size(); ++i) {
+      db->saveDagBlock(dag_blocks[i]);
+      auto batch = db->createWriteBatch();
+      db->putFinalizedDagBlockHashesByAnchor(*batch, dag_blocks[i].getHash(), {dag_blocks[i].getHash()});
+      db->addPbftBlockPeriodToBatch(pbft_blocks[i].getPeriod(), pbft_blocks[i].getBlockHash(), batch);
+      db->addPbftBlockToBatch(pbft_blocks[i], batch);
+      db->commitWriteBatch(batch);
+    }
+
+    auto const &final_chain = node->getFinalChain();
+    node->getExecutor()->start();
+    for (auto const &pbft_block : pbft_blocks) {
+      if (queued && pbft_block.getPeriod() != pbft_blocks.size()) {
+        continue;
+      }
+      node->getExecutor()->execute(std::make_shared<PbftBlock>(pbft_block));
+      EXPECT_TRUE(wait({10s, 100ms}, [&](auto &ctx) {
+        WAIT_EXPECT_EQ(ctx, final_chain->last_block_number(), pbft_block.getPeriod());
+      }));
+    }
+    node->getExecutor()->stop();
+
+    EXPECT_EQ(db->getNumTransactionExecuted(), trxs.size());
+    for (auto const &receiver : receivers) {
+      EXPECT_EQ(final_chain->getBalance(receiver).first, 1);
+    }
+    std::vector<h256> state_roots;
+    for (uint64_t period = 1; period <= pbft_blocks.size(); ++period) {
+      state_roots.push_back(final_chain->blockHeader(period).stateRoot());
+      // Transaction is executed in the first period it appears in
+      for (auto idx : periods_trxs[period - 1]) {
+        if (period == 1 || idx != periods_trxs[period - 2].back()) {
+          EXPECT_EQ(final_chain->localisedTransactionReceipt(trxs[idx].getHash()).blockNumber(), period);
+        }
+      }
+    }
+    return state_roots;
+  };
+
+  auto const one_by_one_state_roots = run(false);
+  remove_all(node_cfg.db_path);
+  create_directories(node_cfg.db_path);
+  EXPECT_EQ(run(true), one_by_one_state_roots);
+}
+
+TEST_F(FullNodeTest, synced_pbft_blocks_batches_across_restart) {
+  // Synced blocks are batched up to 100 blocks, DPOS delay lets cert votes of the whole batch be checked before the
+  // batch is executed. Long lambda keeps the node from finalizing its own blocks during the test
+  uint64_t const max_batch_size = 100;
+  uint64_t const periods = max_batch_size + 30;
+  uint64_t const bad_cert_period = max_batch_size + 20;
+  auto node_cfg = make_node_cfgs(1).front();
+  node_cfg.chain.final_chain.state.dpos->deposit_delay = 2 * max_batch_size;
+  node_cfg.chain.final_chain.state.dpos->withdrawal_delay = 2 * max_batch_size;
+  auto const sk = dev::Secret(node_cfg.node_secret);
+  auto const node_addr = dev::toAddress(sk);
+
+  // Each period anchors the next DAG block of a single pivot chain
+  std::vector<DagBlock> dag_blocks;
+  std::vector<PbftBlock> pbft_blocks;
+  auto pivot = node_cfg.chain.dag_genesis_block.getHash();
+  auto prev_pbft_hash = blk_hash_t(0);
+  for (uint64_t period = 1; period <= periods; ++period) {
+    pivot = dag_blocks.emplace_back(pivot, period, vec_blk_t{}, vec_trx_t{}, sk).getHash();
+    prev_pbft_hash = pbft_blocks.emplace_back(prev_pbft_hash, pivot, period, node_addr, sk).getBlockHash();
+  }
+
+  auto sync = [&](FullNode::Handle const &node, uint64_t from_period, uint64_t to_period, bool bad_cert) {
+    auto pbft_mgr = node->getPbftManager();
+    for (auto _(0); _ < 100 && !pbft_mgr->getTwoTPlusOne(); ++_) {
+      taraxa::thisThreadSleepForMilliSeconds(10);
+    }
+    ASSERT_GT(pbft_mgr->getTwoTPlusOne(), 0);
+    for (auto period = from_period; period <= to_period; ++period) {
+      auto const &pbft_block = pbft_blocks[period - 1];
+      // Bad certificate votes for another block
+      auto const voted_hash = bad_cert && period == bad_cert_period ? blk_hash_t(1) : pbft_block.getBlockHash();
+      std::vector<Vote> cert_votes;
+      for (size_t i = 0; i < pbft_mgr->getDposWeightedVotesCount() && cert_votes.size() < pbft_mgr->getTwoTPlusOne();
+           ++i) {
+        if (pbft_mgr->shouldSpeak(cert_vote_type, period, 3, i)) {
+          cert_votes.push_back(pbft_mgr->generateVote(voted_hash, cert_vote_type, period, 3, i));
+        }
+      }
+      ASSERT_EQ(cert_votes.size(), pbft_mgr->getTwoTPlusOne());
+      node->getPbftChain()->setSyncedPbftBlockIntoQueue(PbftBlockCert(pbft_block, cert_votes));
+    }
+    pbft_mgr->wakeUp();
+  };
+  auto check_synced = [&](FullNode::Handle const &node, uint64_t last_period) {
+    auto const &db = node->getDB();
+    EXPECT_EQ(node->getPbftChain()->getPbftChainSize(), last_period);
+    EXPECT_EQ(node->getPbftChain()->getLastPbftBlockHash(), pbft_blocks[last_period - 1].getBlockHash());
+    for (uint64_t period = 1; period <= periods; ++period) {
+      auto const dag_blk_period = db->getDagBlockPeriod(dag_blocks[period - 1].getHash());
+      if (period <= last_period) {
+        ASSERT_TRUE(dag_blk_period);
+        EXPECT_EQ(*dag_blk_period, period);
+        EXPECT_EQ(*db->getPeriodPbftBlock(period), pbft_blocks[period - 1].getBlockHash());
+      } else {
+        EXPECT_FALSE(dag_blk_period);
+        EXPECT_FALSE(db->getPeriodPbftBlock(period));
+      }
+    }
+  };
+  auto wait_executed = [](FullNode::Handle const &node, uint64_t last_period) {
+    auto const &final_chain = node->getFinalChain();
+    EXPECT_TRUE(wait({20s, 100ms}, [&](auto &ctx) {
+      WAIT_EXPECT_EQ(ctx, final_chain->last_block_number(), last_period);
+    }));
+    // Executor gets the last block of each batch and executes the periods before it from DB
+    for (uint64_t period = 1; period <= last_period; ++period) {
+      EXPECT_EQ(final_chain->blockHeader(period).number(), period);
+    }
+  };
+
+  {
+    FullNode::Handle node(node_cfg, true);
+    for (auto const &dag_block : dag_blocks) {
+      node->getDagManager()->addDagBlock(dag_block);
+    }
+    // A full batch and the partial batch before the bad certificate are committed, the rest of the queue is dropped
+    sync(node, 1, periods, true);
+    EXPECT_TRUE(wait({20s, 100ms}, [&](auto &ctx) {
+      WAIT_EXPECT_EQ(ctx, node->getPbftChain()->getPbftChainSize(), bad_cert_period - 1);
+    }));
+    EXPECT_EQ(node->getPbftChain()->pbftSyncedQueueSize(), 0);
+    wait_executed(node, bad_cert_period - 1);
+    check_synced(node, bad_cert_period - 1);
+  }
+  {
+    FullNode::Handle node(node_cfg, true);
+    check_synced(node, bad_cert_period - 1);
+    wait_executed(node, bad_cert_period - 1);
+
+    // DAG blocks above the last synced anchor are restored unordered, sync continues from there
+    sync(node, bad_cert_period, periods, false);
+    EXPECT_TRUE(wait({20s, 100ms}, [&](auto &ctx) {
+      WAIT_EXPECT_EQ(ctx, node->getPbftChain()->getPbftChainSize(), periods);
+    }));
+    wait_executed(node, periods);
+    check_synced(node, periods);
+  }
+}
+
 TEST_F(FullNodeTest, chain_config_json) {
   string expected_default_chain_cfg_json = R"({
   "dag_genesis_block": {
@@ -11,6 +11,7 @@
 #include "consensus/pbft_manager.hpp"
 #include "dag/dag.hpp"
 #include "logger/log.hpp"
+#include "network/pbft_sync_scheduler.hpp"
 #include "util/lazy.hpp"
 #include "util_test/samples.hpp"
 #include "util_test/util.hpp"
@@ -53,9 +54,7 @@ TEST_F(NetworkTest, transfer_block) {
                {g_signed_trx_samples[0].getHash(), g_signed_trx_samples[1].getHash()}, sig_t(7777), blk_hash_t(888),
                addr_t(999));
 
-  std::vector<taraxa::bytes> transactions;
-  transactions.emplace_back(*g_signed_trx_samples[0].rlp());
-  transactions.emplace_back(*g_signed_trx_samples[1].rlp());
+  std::vector<Transaction> transactions{g_signed_trx_samples[0], g_signed_trx_samples[1]};
   nw2->onNewTransactions(transactions);
 
   taraxa::thisThreadSleepForSeconds(1);
@@ -122,6 +121,30 @@ TEST_F(NetworkTest, transfer_transaction) {
   ASSERT_EQ(3, num_received);
 }
 
+TEST_F(NetworkTest, peer_known_filters) {
+  TaraxaPeer peer;
+  std::vector<trx_hash_t> hashes;
+  for (int i = 0; i < 1000; ++i) {
+    hashes.push_back(trx_hash_t::random());
+    peer.markTransactionAsKnown(hashes.back());
+  }
+  for (auto const &hash : hashes) {
+    EXPECT_TRUE(peer.isTransactionKnown(hash));
+  }
+  peer.clearAllKnownBlocksAndTransactions();
+  EXPECT_FALSE(peer.isTransactionKnown(hashes.front()));
+
+  // Only the most recent items are kept, old ones are reported only as false positives
+  util::RollingBloomFilter filter(100, 0.001);
+  for (auto const &hash : hashes) {
+    filter.insert(hash);
+  }
+  EXPECT_TRUE(filter.contains(hashes.back()));
+  auto old_known =
+      std::count_if(hashes.begin(), hashes.begin() + 500, [&](auto const &hash) { return filter.contains(hash); });
+  EXPECT_LE(old_known, 5);
+}
+
 // Test verifies saving network to a file and restoring it from a file
 // is successfull. Once restored from the file it is able to reestablish
 // connections even with boot nodes down
@@ -1012,6 +1035,33 @@ TEST_F(NetworkTest, node_transaction_sync) {
   }
 }
 
+// Test verifies that peers which received only transaction hashes request and receive the transactions
+TEST_F(NetworkTest, node_transaction_announcement) {
+  auto node_cfgs = make_node_cfgs(2);
+  for (auto& cfg : node_cfgs) {
+    cfg.network.network_min_transaction_broadcast = 0;
+    cfg.network.network_max_transaction_broadcast = 0;
+  }
+  auto nodes = launch_nodes(node_cfgs);
+  auto& node1 = nodes[0];
+  auto& node2 = nodes[1];
+
+  for (auto const& t : *g_signed_trx_samples) {
+    EXPECT_TRUE(node1->getTransactionManager()->insertTransaction(t, true, true).first);
+  }
+
+  EXPECT_HAPPENS({10s, 500ms}, [&](auto& ctx) {
+    for (auto const& t : *g_signed_trx_samples) {
+      WAIT_EXPECT_EQ(ctx, node2->getTransactionManager()->getTransaction(t.getHash()) != nullptr, true);
+    }
+  });
+  for (auto const& t : *g_signed_trx_samples) {
+    if (auto trx = node2->getTransactionManager()->getTransaction(t.getHash())) {
+      EXPECT_EQ(t, trx->first);
+    }
+  }
+}
+
 // Test creates multiple nodes and creates new transactions in random time
 // intervals on randomly selected nodes It verifies that the blocks created from
 // these transactions which get created on random nodes are synced and the
@@ -1116,6 +1166,74 @@ TEST_F(NetworkTest, node_full_sync) {
   }
 }
 
+TEST_F(NetworkTest, pbft_sync_scheduler_ranges_in_order) {
+  PbftSyncScheduler scheduler(10, 2, 1000);
+  PbftSyncScheduler::NodeID peer1(1), peer2(2), peer3(3);
+  scheduler.start(0);
+  auto requests = scheduler.schedule({{peer1, 100}, {peer2, 100}, {peer3, 100}}, 0);
+  // Only two peers download at the same time
+  ASSERT_EQ(requests.size(), 2u);
+  EXPECT_EQ(requests[0].from, 1u);
+  EXPECT_EQ(requests[1].from, 11u);
+  EXPECT_EQ(requests[1].count, 10u);
+
+  // Second range is held back until the first one arrives
+  EXPECT_TRUE(scheduler.onResponse(peer2, 10, 11, bytes{2}));
+  EXPECT_TRUE(scheduler.popReady().empty());
+  EXPECT_TRUE(scheduler.onResponse(peer1, 10, 1, bytes{1}));
+  auto ready = scheduler.popReady();
+  ASSERT_EQ(ready.size(), 2u);
+  EXPECT_EQ(ready[0].packet, bytes{1});
+  EXPECT_EQ(ready[1].packet, bytes{2});
+  EXPECT_EQ(scheduler.nextPeriod(), 21u);
+  EXPECT_TRUE(scheduler.idle());
+}
+
+TEST_F(NetworkTest, pbft_sync_scheduler_timeout_and_short_response) {
+  PbftSyncScheduler scheduler(10, 2, 1000);
+  PbftSyncScheduler::NodeID peer1(1), peer2(2);
+  scheduler.start(0);
+  auto requests = scheduler.schedule({{peer1, 100}, {peer2, 15}}, 0);
+  ASSERT_EQ(requests.size(), 2u);
+
+  // Peer has fewer blocks than it reported, the rest is requested again
+  auto request = scheduler.onResponse(peer2, 3, 11, bytes{2});
+  ASSERT_TRUE(request);
+  EXPECT_EQ(request->from, 11u);
+
+  // Range of the timed out peer goes to the other peer first
+  requests = scheduler.schedule({{peer1, 100}, {peer2, 15}}, 1000);
+  ASSERT_EQ(requests.size(), 1u);
+  EXPECT_EQ(requests[0].peer, peer2);
+  EXPECT_EQ(requests[0].from, 1u);
+  EXPECT_FALSE(scheduler.onResponse(peer1, 10, 1, bytes{1}));
+
+  // Peer reported a longer chain than it has, so the rest of its short range goes to the other peer
+  EXPECT_TRUE(scheduler.onResponse(peer2, 10, 1, bytes{1}));
+  requests = scheduler.schedule({{peer1, 100}, {peer2, 15}}, 1000);
+  ASSERT_EQ(requests.size(), 1u);
+  EXPECT_EQ(requests[0].peer, peer1);
+  EXPECT_EQ(requests[0].from, 14u);
+  EXPECT_EQ(requests[0].count, 2u);
+  EXPECT_EQ(scheduler.popReady().size(), 2u);
+}
+
+TEST_F(NetworkTest, pbft_sync_scheduler_response_of_other_range) {
+  PbftSyncScheduler scheduler(10, 2, 1000);
+  PbftSyncScheduler::NodeID peer1(1), peer2(2);
+  scheduler.start(0);
+  auto requests = scheduler.schedule({{peer1, 100}, {peer2, 100}}, 0);
+  ASSERT_EQ(requests.size(), 2u);
+
+  // Response starting at another period is dropped, the request is still answered later
+  EXPECT_FALSE(scheduler.onResponse(peer1, 10, 11, bytes{2}));
+  EXPECT_EQ(scheduler.inFlight(), 2u);
+  EXPECT_TRUE(scheduler.onResponse(peer1, 10, 1, bytes{1}));
+  auto ready = scheduler.popReady();
+  ASSERT_EQ(ready.size(), 1u);
+  EXPECT_EQ(ready[0].packet, bytes{1});
+}
+
 }  // namespace taraxa::core_tests
 
 using namespace taraxa;
@@ -199,9 +199,7 @@ TEST_F(P2PTest, capability_send_block) {
                {g_signed_trx_samples[0].getHash(), g_signed_trx_samples[1].getHash()}, sig_t(7777), blk_hash_t(888),
                addr_t(999));
 
-  std::vector<taraxa::bytes> transactions;
-  transactions.emplace_back(*g_signed_trx_samples[0].rlp());
-  transactions.emplace_back(*g_signed_trx_samples[1].rlp());
+  std::vector<Transaction> transactions{g_signed_trx_samples[0], g_signed_trx_samples[1]};
   thc2->onNewTransactions(transactions, true);
   thc2->sendBlock(host1->id(), blk);
 
@@ -307,9 +305,7 @@ TEST_F(P2PTest, block_propagate) {
                {g_signed_trx_samples[0].getHash(), g_signed_trx_samples[1].getHash()}, sig_t(7777), blk_hash_t(0),
                addr_t(999));
 
-  std::vector<taraxa::bytes> transactions;
-  transactions.emplace_back(*g_signed_trx_samples[0].rlp());
-  transactions.emplace_back(*g_signed_trx_samples[1].rlp());
+  std::vector<Transaction> transactions{g_signed_trx_samples[0], g_signed_trx_samples[1]};
   thc1->onNewTransactions(transactions, true);
   std::vector<Transaction> transactions2;
   thc1->onNewBlockReceived(blk, transactions2);
@@ -519,6 +519,78 @@ TEST_F(PbftManagerTest, check_committeeSize_greater_than_activePlayers) {
   check_2tPlus1_validVotingPlayers_activePlayers_threshold(6);
 }
 
+TEST_F(PbftManagerTest, round_ends_on_votes_before_step_timer) {
+  auto node_cfgs = make_node_cfgs(1);
+  auto const lambda_ms = node_cfgs[0].chain.pbft.lambda_ms_min;
+  FullNode::Handle node(node_cfgs[0], true);
+  auto pbft_mgr = node->getPbftManager();
+  for (auto _(0); _ < 100 && !pbft_mgr->getTwoTPlusOne(); ++_) {
+    taraxa::thisThreadSleepForMilliSeconds(10);
+  }
+  ASSERT_GT(pbft_mgr->getTwoTPlusOne(), 0);
+
+  // Next votes of the first round from the node weighted votes, as if they came from peers
+  uint64_t const round = 1;
+  size_t const step = 4;
+  std::vector<Vote> next_votes;
+  for (size_t i = 0; i < pbft_mgr->getDposWeightedVotesCount() && next_votes.size() < pbft_mgr->getTwoTPlusOne();
+       ++i) {
+    if (pbft_mgr->shouldSpeak(next_vote_type, round, step, i)) {
+      next_votes.push_back(pbft_mgr->generateVote(NULL_BLOCK_HASH, next_vote_type, round, step, i));
+    }
+  }
+  ASSERT_EQ(next_votes.size(), pbft_mgr->getTwoTPlusOne());
+  ASSERT_EQ(pbft_mgr->getPbftRound(), round);
+
+  // Node waits for the filter step timer of 2 lambda after proposal, the votes wake it up before that
+  auto const start = std::chrono::steady_clock::now();
+  node->getVoteManager()->addUnverifiedVotes(next_votes);
+  pbft_mgr->wakeUp();
+  while (pbft_mgr->getPbftRound() == round &&
+         std::chrono::steady_clock::now() - start < std::chrono::milliseconds(2 * lambda_ms)) {
+    taraxa::thisThreadSleepForMilliSeconds(10);
+  }
+  EXPECT_EQ(pbft_mgr->getPbftRound(), round + 1);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(lambda_ms / 2));
+}
+
+TEST_F(PbftManagerTest, consensus_metrics) {
+  PbftMetrics metrics;
+  metrics.onStep(value_proposal_state, 1, 1);
+  metrics.onStep(value_proposal_state, 1, 1);
+  metrics.onStep(filter_state, 1, 2);
+  metrics.onQuorum(soft_vote_type, 1, 30);
+  // Only the first quorum in a round is recorded
+  metrics.onQuorum(soft_vote_type, 1, 3000);
+  metrics.onQuorum(soft_vote_type, 2, 3000);
+  metrics.onFinalized(1, dev::utcTime());
+  metrics.onFinalized(4, dev::utcTime());
+  // Rounds of periods synced from peers are not counted for the next finalized period
+  metrics.onSynced(20);
+  metrics.onFinalized(21, dev::utcTime());
+  metrics.onExecutorLag(0);
+
+  auto json = metrics.getJson();
+  EXPECT_EQ(json["time_in_state_ms"]["value_proposal"]["count"].asUInt64(), 1);
+  EXPECT_EQ(json["time_in_state_ms"]["filter"]["count"].asUInt64(), 0);
+  auto const &soft_quorum = json["time_to_2t_plus_1_ms"]["soft"];
+  EXPECT_EQ(soft_quorum["count"].asUInt64(), 2);
+  EXPECT_EQ(soft_quorum["sum"].asUInt64(), 3030);
+  EXPECT_EQ(soft_quorum["max"].asUInt64(), 3000);
+  // Buckets are cumulative, 30 is in the bucket up to 50, 3000 in the bucket up to 5000
+  auto const &buckets = soft_quorum["buckets"];
+  ASSERT_EQ(buckets.size(), util::Histogram::c_bounds.size() + 1);
+  EXPECT_EQ(buckets[4]["count"].asUInt64(), 0);
+  EXPECT_EQ(buckets[5]["le"].asUInt64(), 50);
+  EXPECT_EQ(buckets[5]["count"].asUInt64(), 1);
+  EXPECT_EQ(buckets[11]["count"].asUInt64(), 2);
+  EXPECT_EQ(buckets[buckets.size() - 1]["le"].asString(), "+Inf");
+  EXPECT_EQ(json["rounds_per_period"]["count"].asUInt64(), 2);
+  EXPECT_EQ(json["rounds_per_period"]["sum"].asUInt64(), 4);
+  EXPECT_EQ(json["proposal_to_finalization_ms"]["count"].asUInt64(), 3);
+  EXPECT_EQ(json["executor_lag_periods"]["count"].asUInt64(), 1);
+}
+
 }  // namespace taraxa::core_tests
 
 using namespace taraxa;
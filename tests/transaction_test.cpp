@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 #include <libdevcore/CommonJS.h>
 
+#include <future>
 #include <thread>
 #include <vector>
 
@@ -164,6 +165,239 @@ TEST_F(TransactionTest, transaction_limit) {
   EXPECT_EQ(verified_trxs3.size(), g_trx_samples->size() - 30);
 }
 
+TEST_F(TransactionTest, pending_pool_order) {
+  auto sk1 = secret_t::random();
+  auto sk2 = secret_t::random();
+  std::list<Transaction> buffer;
+  // sender1: nonces 0, 1, 1 (duplicate), 3 (gap) with low gas price, sender2: nonces 0, 1 with high gas price
+  buffer.emplace_back(0, 0, 1, 0, bytes(), sk1, addr_t(1));
+  buffer.emplace_back(1, 0, 1, 0, bytes(), sk1, addr_t(1));
+  buffer.emplace_back(1, 1, 1, 0, bytes(), sk1, addr_t(1));
+  buffer.emplace_back(3, 0, 1, 0, bytes(), sk1, addr_t(1));
+  buffer.emplace_back(1, 0, 10, 0, bytes(), sk2, addr_t(1));
+  buffer.emplace_back(0, 0, 5, 0, bytes(), sk2, addr_t(1));
+
+  PendingTransactionPool pool;
+  for (auto it = buffer.begin(); it != buffer.end(); ++it) {
+    EXPECT_TRUE(pool.insert(it->getHash(), it));
+  }
+  EXPECT_FALSE(pool.insert(buffer.begin()->getHash(), buffer.begin()));
+  EXPECT_EQ(pool.size(), 6);
+
+  auto sender1 = dev::KeyPair(sk1).address();
+  auto sender2 = dev::KeyPair(sk2).address();
+  std::unordered_map<addr_t, uint64_t> state_nonces{{sender1, 0}, {sender2, 0}};
+  auto state_nonce = [&](addr_t const& sender) -> std::optional<uint64_t> { return state_nonces[sender]; };
+  std::vector<PendingTransactionPool::Item> stale;
+
+  // Higher gas price sender goes first, its transactions stay nonce ordered
+  auto packed = pool.popExecutable(2, {}, state_nonce, &stale);
+  ASSERT_EQ(packed.size(), 2);
+  EXPECT_EQ(packed[0].second->getGasPrice(), 5);
+  EXPECT_EQ(packed[1].second->getGasPrice(), 10);
+  EXPECT_TRUE(pool.popExecutable(0, [&](addr_t const& sender) { return sender == sender2; }, state_nonce).empty());
+
+  // Only one of the duplicate nonces is packed, nonce 3 is held back because of the gap
+  packed = pool.popExecutable(0, {}, state_nonce, &stale);
+  ASSERT_EQ(packed.size(), 2);
+  EXPECT_EQ(packed[0].second->getNonce(), 0);
+  EXPECT_EQ(packed[1].second->getNonce(), 1);
+  ASSERT_EQ(stale.size(), 1);
+  EXPECT_EQ(stale[0].second->getNonce(), 1);
+  EXPECT_TRUE(pool.popExecutable(0, {}, state_nonce, &stale).empty());
+  EXPECT_EQ(pool.size(), 1);
+
+  // Gap filled by state (e.g. nonce 2 was packed by other proposer)
+  state_nonces[sender1] = 3;
+  packed = pool.popExecutable(0, {}, state_nonce, &stale);
+  ASSERT_EQ(packed.size(), 1);
+  EXPECT_EQ(packed[0].second->getNonce(), 3);
+  EXPECT_TRUE(pool.empty());
+
+  // Transactions with already executed nonce are dropped
+  buffer.emplace_back(2, 0, 1, 0, bytes(), sk2, addr_t(1));
+  pool.insert(buffer.back().getHash(), std::prev(buffer.end()));
+  state_nonces[sender2] = 5;
+  stale.clear();
+  EXPECT_TRUE(pool.popExecutable(0, {}, state_nonce, &stale).empty());
+  EXPECT_EQ(stale.size(), 1);
+  EXPECT_TRUE(pool.empty());
+
+  // Without state nonces transactions are only ordered by nonce
+  buffer.emplace_back(7, 0, 1, 0, bytes(), sk1, addr_t(1));
+  pool.insert(buffer.back().getHash(), std::prev(buffer.end()));
+  buffer.emplace_back(5, 0, 1, 0, bytes(), sk1, addr_t(1));
+  pool.insert(buffer.back().getHash(), std::prev(buffer.end()));
+  packed = pool.popExecutable();
+  ASSERT_EQ(packed.size(), 2);
+  EXPECT_EQ(packed[0].second->getNonce(), 5);
+  EXPECT_EQ(packed[1].second->getNonce(), 7);
+}
+
+TEST_F(TransactionTest, pool_limits) {
+  TransactionPoolConfig config;
+  config.max_transactions = 3;
+  config.max_size_mb = 0;
+  config.max_transactions_per_sender = 2;
+  config.price_bump_percent = 10;
+  TransactionQueue queue(addr_t(), config);
+
+  auto sk1 = secret_t::random();
+  auto sk2 = secret_t::random();
+  auto sk3 = secret_t::random();
+  Transaction trx1(0, 0, 10, 0, bytes(), sk1, addr_t(1));
+  Transaction trx2(1, 0, 5, 0, bytes(), sk1, addr_t(1));
+  EXPECT_TRUE(queue.insert(trx1, true).empty());
+  EXPECT_TRUE(queue.insert(trx2, true).empty());
+
+  // Sender over its cap
+  EXPECT_FALSE(queue.checkPoolLimits(Transaction(2, 0, 100, 0, bytes(), sk1, addr_t(1))).first);
+
+  // Same nonce replacement requires gas price bump
+  EXPECT_FALSE(queue.checkPoolLimits(Transaction(1, 0, 5, 1, bytes(), sk1, addr_t(1))).first);
+  Transaction replacement(1, 0, 6, 0, bytes(), sk1, addr_t(1));
+  ASSERT_TRUE(queue.checkPoolLimits(replacement).first);
+  EXPECT_EQ(queue.insert(replacement, true), std::vector<trx_hash_t>{trx2.getHash()});
+
+  // Full pool evicts the cheapest transaction only for a better priced one
+  Transaction cheapest(0, 0, 1, 0, bytes(), sk2, addr_t(1));
+  EXPECT_TRUE(queue.insert(cheapest, true).empty());
+  EXPECT_FALSE(queue.checkPoolLimits(Transaction(0, 0, 1, 0, bytes(), sk3, addr_t(1))).first);
+  Transaction better(0, 0, 7, 0, bytes(), sk3, addr_t(1));
+  ASSERT_TRUE(queue.checkPoolLimits(better).first);
+  EXPECT_EQ(queue.insert(better, true), std::vector<trx_hash_t>{cheapest.getHash()});
+  EXPECT_EQ(queue.getVerifiedTrxCount(), 3);
+  EXPECT_EQ(queue.getTransaction(cheapest.getHash()), nullptr);
+}
+
+TEST_F(TransactionTest, batch_verification) {
+  TransactionManager trx_mgr(s_ptr(new DbStorage(data_dir)), addr_t());
+  trx_mgr.start();
+
+  std::vector<Transaction> trxs;
+  for (uint32_t i = 0; i < 500; ++i) {
+    // every 7th transaction has chain_id mismatch
+    trxs.emplace_back(i, 0, 0, 0, bytes(), g_secret, addr_t(i), i % 7 == 0 ? 1 : 0);
+  }
+  auto results = trx_mgr.verifyTransactions(trxs);
+  ASSERT_EQ(results.size(), trxs.size());
+  for (uint32_t i = 0; i < trxs.size(); ++i) {
+    EXPECT_EQ(results[i].first, i % 7 != 0);
+  }
+  trx_mgr.stop();
+}
+
+TEST_F(TransactionTest, raw_transactions_batch) {
+  TransactionManager trx_mgr(s_ptr(new DbStorage(data_dir)), addr_t());
+  trx_mgr.start();
+
+  Transaction valid(0, 0, 0, 0, bytes(), g_secret, addr_t(1));
+  Transaction invalid(1, 0, 0, 0, bytes(), g_secret, addr_t(1), 1);
+  std::vector<bytes> raw_trxs{*valid.rlp(), bytes{0x01, 0x02}, *invalid.rlp(), *valid.rlp()};
+
+  auto results = trx_mgr.insertRawTransactions(raw_trxs, false);
+  ASSERT_EQ(results.size(), raw_trxs.size());
+  EXPECT_EQ(results[0], std::make_pair(valid.getHash(), std::string()));
+  EXPECT_EQ(results[1].first, trx_hash_t());
+  EXPECT_FALSE(results[1].second.empty());
+  EXPECT_EQ(results[2], std::make_pair(invalid.getHash(), std::string("chain_id mismatch")));
+  EXPECT_EQ(results[3], std::make_pair(valid.getHash(), std::string("duplicate in batch")));
+  EXPECT_EQ(trx_mgr.getTransactionQueueSize().second, 1);
+
+  // Already known transactions are reported, not inserted again
+  results = trx_mgr.insertRawTransactions({*valid.rlp()}, false);
+  EXPECT_EQ(results[0].second, "in verified queue");
+
+  // Only never seen transactions are requested after announcement
+  Transaction unseen(2, 0, 0, 0, bytes(), g_secret, addr_t(1));
+  EXPECT_EQ(trx_mgr.filterUnseenTransactions({valid.getHash(), invalid.getHash(), unseen.getHash()}),
+            vec_trx_t{unseen.getHash()});
+  trx_mgr.stop();
+}
+
+TEST_F(TransactionTest, broadcasted_transactions_async) {
+  TransactionManager trx_mgr(s_ptr(new DbStorage(data_dir)), addr_t());
+  trx_mgr.start();
+
+  Transaction valid(0, 0, 0, 0, bytes(), g_secret, addr_t(1));
+  Transaction invalid(1, 0, 0, 0, bytes(), g_secret, addr_t(1), 1);
+  std::promise<vec_trx_t> decoded;
+  std::promise<uint32_t> inserted;
+  trx_mgr.insertBroadcastedTransactions(
+      {*valid.rlp(), bytes{0x01, 0x02}, *invalid.rlp()},
+      [&](vec_trx_t const &hashes) { decoded.set_value(hashes); },
+      [&](uint32_t count) { inserted.set_value(count); });
+
+  // Malformed transaction has no hash, invalid one is known to peer anyway
+  EXPECT_EQ(decoded.get_future().get(), (vec_trx_t{valid.getHash(), invalid.getHash()}));
+  EXPECT_EQ(inserted.get_future().get(), 1);
+  EXPECT_EQ(trx_mgr.getTransactionQueueSize().second, 1);
+  trx_mgr.stop();
+}
+
+TEST_F(TransactionTest, parallel_for_exception) {
+  util::ThreadPool pool(4);
+  std::atomic<size_t> processed = 0;
+  EXPECT_THROW(pool.parallel_for(1000, 1,
+                                 [&](size_t from, size_t to) {
+                                   if (from == 0) {
+                                     throw std::runtime_error("first chunk");
+                                   }
+                                   thisThreadSleepForMilliSeconds(10);
+                                   processed += to - from;
+                                 }),
+               std::runtime_error);
+  // Exception is rethrown only after the rest of chunks is done
+  EXPECT_EQ(processed, 1000 - (1000 / 4 + 1));
+}
+
+TEST_F(TransactionTest, status_index) {
+  TransactionStatusIndex index(1000);
+  auto queued = trx_hash_t::random(), packed = trx_hash_t::random(), unknown = trx_hash_t::random();
+  EXPECT_EQ(index.get(queued), TransactionStatus::not_seen);
+
+  index.update(queued, TransactionStatus::in_queue_unverified);
+  index.update(packed, TransactionStatus::in_queue_verified);
+  index.update(queued, TransactionStatus::in_queue_verified);
+  EXPECT_EQ(index.get(queued), TransactionStatus::in_queue_verified);
+  EXPECT_EQ(index.get(packed), TransactionStatus::in_queue_verified);
+
+  // Final statuses must be read from db
+  index.update(packed, TransactionStatus::in_block);
+  EXPECT_EQ(index.get(packed), std::nullopt);
+  EXPECT_EQ(index.get(unknown), TransactionStatus::not_seen);
+
+  // Statuses from before restart are read from db, queued ones included
+  TransactionStatusIndex loaded(1000);
+  ASSERT_TRUE(loaded.load(index.serialize()));
+  EXPECT_EQ(loaded.get(queued), std::nullopt);
+  EXPECT_EQ(loaded.get(packed), std::nullopt);
+  EXPECT_EQ(loaded.get(unknown), TransactionStatus::not_seen);
+  EXPECT_FALSE(TransactionStatusIndex(2000).load(index.serialize()));
+
+  // Hashes sharing long zero prefix do not collide in filter
+  TransactionStatusIndex structured(1000);
+  structured.update(trx_hash_t(1), TransactionStatus::in_block);
+  for (unsigned i = 2; i < 100; ++i) {
+    EXPECT_EQ(structured.get(trx_hash_t(i)), TransactionStatus::not_seen);
+  }
+}
+
+TEST_F(TransactionTest, status_index_persistence) {
+  auto db = s_ptr(new DbStorage(data_dir));
+  Transaction trx(0, 0, 0, 0, bytes(), g_secret, addr_t(1));
+  {
+    TransactionManager trx_mgr(db, addr_t());
+    trx_mgr.start();
+    EXPECT_TRUE(trx_mgr.insertTransaction(trx, true, false).first);
+  }
+  EXPECT_FALSE(db->getTransactionStatusIndex().empty());
+
+  TransactionManager trx_mgr(db, addr_t());
+  EXPECT_TRUE(db->getTransactionStatusIndex().empty());
+  EXPECT_TRUE(trx_mgr.filterUnseenTransactions({trx.getHash()}).empty());
+}
+
 TEST_F(TransactionTest, prepare_signed_trx_for_propose) {
   TransactionManager trx_mgr(s_ptr(new DbStorage(data_dir)), addr_t());
   trx_mgr.start();
@@ -167,6 +167,87 @@ TEST_F(VoteTest, add_cleanup_get_votes) {
   EXPECT_TRUE(verified_votes.empty());
 }
 
+TEST_F(VoteTest, invalid_vrf_proof_votes) {
+  auto node_cfgs = make_node_cfgs(1);
+  FullNode::Handle node(node_cfgs[0]);
+
+  // stop PBFT manager, that will place vote
+  auto pbft_mgr = node->getPbftManager();
+  pbft_mgr->stop();
+
+  clearAllVotes(node);
+
+  auto vote_mgr = node->getVoteManager();
+  blk_hash_t blockhash(1);
+  uint64_t round = 1;
+  Vote valid_vote = pbft_mgr->generateVote(blockhash, propose_vote_type, round, 1, 0);
+  // Same vote with a forged VRF proof
+  auto const &sortition = valid_vote.getVrfSortition();
+  dev::RLPStream sortition_rlp(6);
+  sortition_rlp << sortition.pk << sortition.pbft_msg.type << sortition.pbft_msg.round << sortition.pbft_msg.step
+                << sortition.pbft_msg.weighted_index << vrf_proof_t::random();
+  dev::RLPStream vote_rlp(3);
+  vote_rlp << blockhash << sortition_rlp.out() << valid_vote.getVoteSignature();
+  Vote invalid_vote(vote_rlp.out());
+
+  EXPECT_TRUE(vote_mgr->verifyVoteCrypto(valid_vote));
+  EXPECT_FALSE(vote_mgr->verifyVoteCrypto(invalid_vote));
+
+  vote_mgr->addUnverifiedVotes({valid_vote, invalid_vote});
+  size_t valid_sortition_players = 1;
+  pbft_mgr->setSortitionThreshold(valid_sortition_players);
+  auto votes = vote_mgr->getVerifiedVotes(round, pbft_mgr->getSortitionThreshold(), valid_sortition_players,
+                                          [](...) { return true; });
+  ASSERT_EQ(votes.size(), 1);
+  EXPECT_EQ(votes[0].getHash(), valid_vote.getHash());
+}
+
+TEST_F(VoteTest, vote_index_tallies) {
+  auto make_vote = [](PbftVoteTypes type, uint64_t round, size_t step, size_t weighted_index, blk_hash_t blockhash) {
+    return Vote(g_sk, VrfPbftSortition(g_vrf_sk, VrfPbftMsg(type, round, step, weighted_index)), blockhash);
+  };
+  blk_hash_t block1(1), block2(2);
+  VoteIndex index;
+  EXPECT_TRUE(index.insert(make_vote(soft_vote_type, 2, 2, 0, block1)));
+  EXPECT_TRUE(index.insert(make_vote(soft_vote_type, 2, 2, 1, block2)));
+  EXPECT_TRUE(index.insert(make_vote(soft_vote_type, 2, 2, 2, block2)));
+  // Duplicates are not counted
+  EXPECT_FALSE(index.insert(make_vote(soft_vote_type, 2, 2, 2, block2)));
+  EXPECT_TRUE(index.insert(make_vote(cert_vote_type, 2, 3, 0, block1)));
+  EXPECT_EQ(index.size(), 4);
+
+  EXPECT_EQ(index.getVotes(soft_vote_type, 2, 2).size(), 3);
+  EXPECT_EQ(index.getVotes(soft_vote_type, 2, 2, block2).size(), 2);
+  EXPECT_EQ(index.getVotes(cert_vote_type, 2).size(), 1);
+  EXPECT_TRUE(index.getVotes(soft_vote_type, 2, 3).empty());
+  auto soft_voted_block = index.blockWithEnoughVotes(soft_vote_type, 2, 2, 2);
+  ASSERT_TRUE(soft_voted_block);
+  EXPECT_EQ(*soft_voted_block, block2);
+  EXPECT_FALSE(index.blockWithEnoughVotes(soft_vote_type, 2, 2, 3));
+  EXPECT_FALSE(index.blockWithEnoughVotes(cert_vote_type, 2, 2, 1));
+
+  for (size_t weighted_index = 0; weighted_index < 2; ++weighted_index) {
+    index.insert(make_vote(next_vote_type, 2, 4, weighted_index, block1));
+    index.insert(make_vote(next_vote_type, 3, 5, weighted_index, NULL_BLOCK_HASH));
+  }
+  index.insert(make_vote(next_vote_type, 3, 6, 0, NULL_BLOCK_HASH));
+  auto next_voted = index.highestRoundStepWithEnoughVotes(next_vote_type, 2, 2);
+  ASSERT_TRUE(next_voted);
+  EXPECT_EQ(next_voted->first, 3);
+  EXPECT_EQ(next_voted->second, 5);
+  next_voted = index.highestRoundStepWithEnoughVotes(next_vote_type, 2, 1);
+  ASSERT_TRUE(next_voted);
+  EXPECT_EQ(next_voted->second, 6);
+  EXPECT_FALSE(index.highestRoundStepWithEnoughVotes(next_vote_type, 4, 1));
+
+  index.eraseRoundsBelow(3);
+  EXPECT_EQ(index.size(), 3);
+  EXPECT_TRUE(index.getVotes(soft_vote_type, 2).empty());
+  EXPECT_FALSE(index.highestRoundStepWithEnoughVotes(next_vote_type, 2, 3));
+  index.clear();
+  EXPECT_EQ(index.size(), 0);
+}
+
 TEST_F(VoteTest, reconstruct_votes) {
   public_t pk(12345);
   sig_t sortition_sig(1234567);
@@ -184,6 +265,40 @@ TEST_F(VoteTest, reconstruct_votes) {
   EXPECT_EQ(vote1, vote2);
 }
 
+TEST_F(VoteTest, compact_cert_votes) {
+  blk_hash_t cert_blk_hash(111111);
+  std::vector<Vote> cert_votes;
+  for (size_t weighted_index = 0; weighted_index < 3; ++weighted_index) {
+    VrfPbftSortition vrf_sortition(g_vrf_sk, VrfPbftMsg(cert_vote_type, 999, 3, weighted_index));
+    cert_votes.emplace_back(g_sk, vrf_sortition, cert_blk_hash);
+  }
+
+  // Shared fields are encoded once
+  auto compact = encodeCertVotes(cert_blk_hash, cert_votes);
+  dev::RLPStream legacy(cert_votes.size());
+  for (auto const &v : cert_votes) {
+    legacy.appendRaw(v.rlp(true));
+  }
+  EXPECT_LT(compact.size(), legacy.out().size());
+  EXPECT_EQ(decodeCertVotes(cert_blk_hash, dev::RLP(compact)), cert_votes);
+  EXPECT_EQ(decodeCertVotes(cert_blk_hash, dev::RLP(legacy.out())), cert_votes);
+  // Votes decoded without VRF verification have the same hashes, proofs are verified later
+  auto const unverified = decodeCertVotes(cert_blk_hash, dev::RLP(compact), false);
+  ASSERT_EQ(unverified.size(), cert_votes.size());
+  for (size_t i = 0; i < unverified.size(); ++i) {
+    EXPECT_EQ(unverified[i].getHash(), cert_votes[i].getHash());
+    EXPECT_TRUE(unverified[i].getVrfSortition().verify());
+  }
+
+  // Votes that don't share the fields keep legacy encoding
+  VrfPbftSortition vrf_sortition(g_vrf_sk, VrfPbftMsg(cert_vote_type, 1000, 3, 0));
+  cert_votes.emplace_back(g_sk, vrf_sortition, cert_blk_hash);
+  auto mixed = encodeCertVotes(cert_blk_hash, cert_votes);
+  EXPECT_TRUE(dev::RLP(mixed)[0].isList());
+  EXPECT_EQ(decodeCertVotes(cert_blk_hash, dev::RLP(mixed)), cert_votes);
+  EXPECT_TRUE(decodeCertVotes(cert_blk_hash, dev::RLP(encodeCertVotes(cert_blk_hash, {}))).empty());
+}
+
 // Generate a vote, send the vote from node2 to node1
 TEST_F(VoteTest, transfer_vote) {
   auto node_cfgs = make_node_cfgs(2);